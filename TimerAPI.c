@@ -1,84 +1,260 @@
 
+#define _GNU_SOURCE
 #include "TimerAPI.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <sched.h>
 #include <pthread.h>
 #include <semaphore.h>
 #include <signal.h>
 #include <time.h>
-
-
-INT8U FreeTmrCount = 0;
-RTOS_TMR *FreeTmrListPtr = NULL;
-
-// Tick Counter
-INT32U RTOSTmrTickCtr = 0;
-
-// Hash Table
-HASH_OBJ hash_table[HASH_TABLE_SIZE];
-
-// Thread variable for Timer Task
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+
+
+// Free Timers in the global Free Stack (Timers in the Thread Caches are not counted)
+INT32U FreeTmrCount = 0;
+
+// Global Free Stack, low 32 bits = Index + 1 of the Top Timer (0 = Empty), high 32 bits = ABA Tag
+INT64U FreeTmrStackHead = 0;
+
+// Slab Regions of the Pool and the Chunk holding each Pool Index
+TIMER_SLAB TmrSlab[RTOS_TMR_SLAB_MAX_REGIONS];
+INT32U TmrSlabCount = 0;
+RTOS_TMR *TmrSlabChunk[RTOS_TMR_SLAB_MAX_CHUNKS];
+RTOS_TMR_COLD *TmrSlabColdChunk[RTOS_TMR_SLAB_MAX_CHUNKS];
+RTOS_TMR_NODE *TmrSlabNodeChunk[RTOS_TMR_SLAB_MAX_CHUNKS];
+
+// Number of Timers in the Pool
+INT32U TmrPoolSize = 0;
+
+// Bumped each time the Pool is destroyed, Thread Caches of an older Epoch hold Timers which are gone
+INT32U TmrPoolEpoch = 0;
+
+// First Generation of the Timers of a new Pool, past every Generation of the destroyed Pools so their Handles stay Stale
+INT32U TmrPoolGenBase = 1;
+
+// Mutex for Growing the Timer Pool
+pthread_mutex_t timer_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Free Timers kept by each Thread
+__thread TIMER_CACHE timer_cache;
+
+// Key to drain a Thread Cache back to the Free Stack at Thread Exit
+pthread_key_t timer_cache_key;
+pthread_once_t timer_cache_once = PTHREAD_ONCE_INIT;
+
+// Monotonic Time of Tick 0 in ns
+INT64U RTOSTmrEpochNs = 0;
+
+// Timer Manager Configuration
+#if RTOS_CFG_STATIC
+RTOS_TMR_CFG RTOSTmrCfg = { RTOS_TMR_TICK_SIGNAL, RTOS_CFG_STATIC_TICK_NS, RTOS_FALSE, RTOS_FALSE, RTOS_CFG_STATIC_EXEC_THREADS,
+	RTOS_CFG_STATIC_EXEC_QUEUE, RTOS_CFG_STATIC_SHARDS, RTOS_FALSE, RTOS_CFG_STATIC_POOL, RTOS_TMR_MISS_FIRE_ALL, RTOS_FALSE, 0, 0,
+	RTOS_CFG_STATIC_QUEUE, RTOS_CFG_STATIC_HASH_BUCKETS, 0 };
+#else
+RTOS_TMR_CFG RTOSTmrCfg = { RTOS_TMR_TICK_SIGNAL, RTOS_CFG_TMR_TASK_RATE, RTOS_TRUE, RTOS_FALSE, 0, RTOS_CFG_TMR_EXEC_QUEUE,
+	1, RTOS_FALSE, 0, RTOS_TMR_MISS_FIRE_ALL, RTOS_FALSE, 0, 0, RTOS_TMR_QUEUE_WHEEL, 0, 0 };
+#endif
+
+// Tick Time and Shards, Constants in the Static Build so the Compiler folds every Conversion
+#if RTOS_CFG_STATIC
+#define RTOS_TMR_TICK_NS		((INT64U)RTOS_CFG_STATIC_TICK_NS)
+#define RTOS_TMR_SHARDS			RTOS_CFG_STATIC_SHARDS
+#else
+#define RTOS_TMR_TICK_NS		RTOSTmrCfg.RTOSTmrTickRate
+#define RTOS_TMR_SHARDS			RTOSTmrShardCount
+#endif
+
+// Operations of each Timer Queue, by RTOS_TMR_QUEUE_xxx, and the configured one
+const TIMER_QUEUE_OPS timer_queue_ops[] = {
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ &wheel_link, &wheel_unlink, &wheel_next_event, &wheel_collect_tick, "wheel" },
+	{ &hash_link, &hash_unlink, &hash_next_event, &hash_collect_tick, "hash" },
+	{ &heap_link, &heap_unlink, &heap_next_event, &heap_collect_tick, "heap" },
+	{ &pairing_link, &pairing_unlink, &pairing_next_event, &pairing_collect_tick, "pairing" }
+};
+#if RTOS_CFG_STATIC
+const TIMER_QUEUE_OPS *timer_queue = &timer_queue_ops[RTOS_CFG_STATIC_QUEUE];
+#else
+const TIMER_QUEUE_OPS *timer_queue = &timer_queue_ops[RTOS_TMR_QUEUE_WHEEL];
+#endif
+
+// Ticks counted per SIGALRM Heartbeat
+INT32U RTOSTmrTicksPerBeat = 1;
+
+// Set once RTOSTmrInit() has run, until RTOSTmrShutdown()
+INT8U RTOSTmrInitDone = RTOS_FALSE;
+
+// Set by RTOSTmrShutdown() to end the Timer Tasks and Executor Threads
+INT8U RTOSTmrStopping = RTOS_FALSE;
+
+// POSIX Timer of the SIGALRM Tick Source
+timer_t RTOSTmrTickTimer;
+INT8U RTOSTmrTickTimerValid = RTOS_FALSE;
+
+// Timer Shards, each with its own Timing Wheel, Lock and Timer Task
+TIMER_SHARD *timer_shards = NULL;
+#if RTOS_CFG_STATIC
+INT32U RTOSTmrShardCount = RTOS_CFG_STATIC_SHARDS;
+#else
+INT32U RTOSTmrShardCount = 1;
+#endif
+
+// Shard whose Wheel the calling Thread owns, its Timer Task or the Thread servicing it in Polled mode
+__thread TIMER_SHARD *timer_owner = NULL;
+
+// RTOS_TRUE in the Executor Threads
+__thread INT8U timer_executor = RTOS_FALSE;
+
+// Shard of each CPU for Timers created without an explicit Shard
+INT16U RTOSTmrCpuShard[CPU_SETSIZE];
+
+// Thread variable for the Timer Task of Shard 0, and the Number of Timer Tasks running
 pthread_t thread;
-
-// Semaphore for Signaling the Timer Task
-sem_t timer_task_sem;
-
-// Mutex for Protecting Hash Table
-pthread_mutex_t hash_table_mutex;
-
-// Mutex for Protecting Timer Pool
-pthread_mutex_t timer_pool_mutex;
+INT32U RTOSTmrTaskCount = 0;
+
+// timerfd serviced by the Application in RTOS_TMR_TICK_POLLED mode
+INT32 RTOSTmrTickFd = -1;
+
+// Callback Executor Queue, Semaphore counting its Callbacks and Executor Threads
+EXEC_QUEUE exec_queue;
+sem_t exec_sem;
+pthread_t *exec_threads = NULL;
+INT32U RTOSTmrExecCount = 0;
+
+// Most Timers taken from the global Free Stack at once
+INT64U TmrPoolHighWater = 0;
+
+#if RTOS_CFG_STATIC
+// Storage of the Static Build, the Slab Region of the Pool, the Shards and the Queue Arrays of the configured Queue
+INT8U TmrStaticSlab[(INT64U)RTOS_CFG_STATIC_POOL * (sizeof(RTOS_TMR) + sizeof(RTOS_TMR_COLD) + sizeof(RTOS_TMR_NODE))]
+	__attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+TIMER_SHARD TmrStaticShards[RTOS_CFG_STATIC_SHARDS] __attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+
+#if RTOS_CFG_STATIC_QUEUE == RTOS_TMR_QUEUE_HASH
+INT8U TmrStaticHash[RTOS_CFG_STATIC_SHARDS][(sizeof(RTOS_TMR*) * 2 * RTOS_CFG_STATIC_HASH_BUCKETS)
+	+ (sizeof(INT64U) * (RTOS_CFG_STATIC_HASH_BUCKETS / 64))] __attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+#endif
+
+// Each Heap holds the whole Pool, so it never grows
+#if RTOS_CFG_STATIC_QUEUE == RTOS_TMR_QUEUE_HEAP
+TIMER_HEAP_ENTRY TmrStaticHeap[RTOS_CFG_STATIC_SHARDS][RTOS_CFG_STATIC_POOL + (RTOS_TMR_CACHE_LINE / sizeof(TIMER_HEAP_ENTRY)) - 1]
+	__attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+#endif
+
+#if RTOS_CFG_STATIC_EXEC_THREADS > 0
+EXEC_CELL TmrStaticExecCell[RTOS_CFG_STATIC_EXEC_QUEUE] __attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+pthread_t TmrStaticExecThread[RTOS_CFG_STATIC_EXEC_THREADS];
+#endif
+#endif
+
+#if RTOS_CFG_TMR_STATS
+// Allocation Counters of each Thread, and of the Threads without a Slot or already exited
+TIMER_STATS_SLOT RTOSTmrStatsSlot[RTOS_TMR_STATS_THREADS];
+INT64U RTOSTmrStatsAllocs = 0;
+INT64U RTOSTmrStatsFrees = 0;
+
+// Longest running Callback and a Copy of the Name of its Timer, which a Shutdown frees
+INT64U RTOSTmrStatsCbMaxNs = 0;
+INT8 RTOSTmrStatsCbMaxName[RTOS_TMR_STATS_NAME_LEN];
+pthread_mutex_t timer_stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+// Callback Watchdog, Offender Table and Counters of Overruns and Demotions
+RTOS_TMR_OFFENDER RTOSTmrOffender[RTOS_TMR_OFFENDER_MAX];
+INT32U RTOSTmrOffenderCount = 0;
+pthread_mutex_t timer_offender_mutex = PTHREAD_MUTEX_INITIALIZER;
+INT64U RTOSTmrOverruns = 0;
+INT64U RTOSTmrDemoted = 0;
 
 /*****************************************************
  * Timer API Functions
  *****************************************************
  */
 
-// Function to create a Timer
+// Function to create a Timer on the Shard of the calling CPU
 RTOS_TMR* RTOSTmrCreate(INT32U delay, INT32U period, INT8U option, RTOS_TMR_CALLBACK callback, void *callback_arg, INT8	*name, INT8U *err)
 {
-	RTOS_TMR *timer_obj = NULL;
-	
-	// Check Option validity
-	if((option != RTOS_TMR_ONE_SHOT) && (option != RTOS_TMR_PERIODIC)) {
+	return create_timer_obj(delay, period, option, caller_shard(), callback, callback_arg, name, err);
+}
+
+// Fill up the Timer Attributes with the Defaults
+void RTOSTmrAttrInit(RTOS_TMR_ATTR *attr)
+{
+	attr->RTOSTmrDelayNs = 0;
+	attr->RTOSTmrPeriodNs = 0;
+	attr->RTOSTmrOpt = RTOS_TMR_ONE_SHOT;
+	attr->RTOSTmrShard = RTOS_TMR_SHARD_ANY;
+	attr->RTOSTmrMissPolicy = RTOS_TMR_MISS_DEFAULT;
+	attr->RTOSTmrSlackNs = 0;
+}
+
+// Function to create a Timer with Delay and Period given in ns
+RTOS_TMR* RTOSTmrCreateEx(const RTOS_TMR_ATTR *attr, RTOS_TMR_CALLBACK callback, void *callback_arg, INT8 *name, INT8U *err)
+{
+	INT64U delay;
+	INT64U period;
+	INT64U slack;
+	RTOS_TMR *timer_obj;
+
+	if(attr == NULL) {
+		*err = RTOS_ERR_TMR_INVALID;
+		return NULL;
+	}
+
+	if((attr->RTOSTmrShard != RTOS_TMR_SHARD_ANY) && (attr->RTOSTmrShard >= RTOS_TMR_SHARDS)) {
+		*err = RTOS_ERR_TMR_INVALID_SHARD;
+		return NULL;
+	}
+
+	if(attr->RTOSTmrMissPolicy > RTOS_TMR_MISS_SKIP) {
 		*err = RTOS_ERR_TMR_INVALID_OPT;
 		return NULL;
 	}
 
-	// Check delay and period validity
-	if(option == RTOS_TMR_ONE_SHOT) {
-		if(delay <= 0) {
-			*err = RTOS_ERR_TMR_INVALID_DLY;
-			return NULL;
-		}
+	// Convert to Ticks of the configured Tick Time
+	if(ns_to_ticks(attr->RTOSTmrDelayNs, &delay) == RTOS_FALSE) {
+		*err = RTOS_ERR_TMR_INVALID_DLY;
+		return NULL;
 	}
-	else {
-		if((period <= 0) || (delay < 0)) {
-			*err = RTOS_ERR_TMR_INVALID_DLY;
-			return NULL;
-		}
+
+	if(ns_to_ticks(attr->RTOSTmrPeriodNs, &period) == RTOS_FALSE) {
+		*err = RTOS_ERR_TMR_INVALID_PERIOD;
+		return NULL;
 	}
 
-	// Allocate a Timer
-	timer_obj = alloc_timer_obj();
+	timer_obj = create_timer_obj(delay, period, attr->RTOSTmrOpt,
+		(attr->RTOSTmrShard == RTOS_TMR_SHARD_ANY) ? caller_shard() : attr->RTOSTmrShard,
+		callback, callback_arg, name, err);
 
 	if(timer_obj == NULL) {
-		// Timers are not available
-		*err = RTOS_ERR_TMR_NON_AVAIL;
 		return NULL;
 	}
 
-	// Fill up the Timer Object
-	timer_obj->RTOSTmrType = RTOS_TMR_TYPE;
-	timer_obj->RTOSTmrCallback = callback;
-	timer_obj->RTOSTmrCallbackArg = callback_arg;
-	timer_obj->RTOSTmrDelay = delay;
-	timer_obj->RTOSTmrPeriod = period;
-	timer_obj->RTOSTmrName = name;
-	timer_obj->RTOSTmrOpt = option;
-	timer_obj->RTOSTmrState = RTOS_TMR_STATE_STOPPED;
+	// Missed Period Policy of this Timer, else the configured one
+	if(attr->RTOSTmrMissPolicy != RTOS_TMR_MISS_DEFAULT) {
+		timer_cold(timer_obj)->RTOSTmrMiss = attr->RTOSTmrMissPolicy;
+	}
 
-	*err = RTOS_SUCCESS;
+	// Slack in whole Ticks, less than a Period so a Periodic Timer never skips one
+	slack = attr->RTOSTmrSlackNs / RTOS_TMR_TICK_NS;
+
+	if(((attr->RTOSTmrOpt & RTOS_TMR_OPT_TYPE_MASK) == RTOS_TMR_PERIODIC) && (slack >= period)) {
+		slack = period - 1;
+	}
+
+	// Largest Power of 2 Granularity whose Rounding stays within the Slack
+	if(slack > 0) {
+		timer_cold(timer_obj)->RTOSTmrSlackShift = 63 - __builtin_clzll(slack + 1);
+
+		if(timer_cold(timer_obj)->RTOSTmrSlackShift > RTOS_TMR_SLACK_SHIFT_MAX) {
+			timer_cold(timer_obj)->RTOSTmrSlackShift = RTOS_TMR_SLACK_SHIFT_MAX;
+		}
+	}
 
 	return timer_obj;
 }
@@ -86,6 +262,8 @@ RTOS_TMR* RTOSTmrCreate(INT32U delay, INT32U period, INT8U option, RTOS_TMR_CALL
 // Function to Delete a Timer
 INT8U RTOSTmrDel(RTOS_TMR *ptmr, INT8U *perr)
 {
+	TIMER_SHARD *shard;
+
 	// ERROR Checking
 	if(ptmr == NULL) {
 		*perr = RTOS_ERR_TMR_INVALID;
@@ -97,33 +275,11 @@ INT8U RTOSTmrDel(RTOS_TMR *ptmr, INT8U *perr)
 		return RTOS_FALSE;
 	}
 
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_UNUSED) {
-		*perr = RTOS_ERR_TMR_INACTIVE;
-		return RTOS_FALSE;
-	}
-
-	switch(ptmr->RTOSTmrState) {
-		case RTOS_TMR_STATE_STOPPED:
-		case RTOS_TMR_STATE_COMPLETED:
-			// Free the Timer Object
-			free_timer_obj(ptmr);
-			break;
-
-		case RTOS_TMR_STATE_RUNNING:
-			// Remove the Timer from the Hash Table List
-			remove_hash_entry(ptmr);
+	shard = timer_shard(ptmr);
 
-			// Free the Timer Object
-			free_timer_obj(ptmr);
-			break;
-		default:
-			*perr = RTOS_ERR_TMR_INVALID_STATE;
-			return RTOS_FALSE;
-			break;
-	}
+	*perr = timer_command(shard, ptmr, RTOS_TMR_BATCH_DEL, 0);
 
-	*perr = RTOS_SUCCESS;
-	return RTOS_TRUE;
+	return (*perr == RTOS_SUCCESS) ? RTOS_TRUE : RTOS_FALSE;
 }
 
 // Function to get the Name of a Timer
@@ -140,19 +296,23 @@ INT8* RTOSTmrNameGet(RTOS_TMR *ptmr, INT8U *perr)
 		return RTOS_FALSE;
 	}
 
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_UNUSED) {
+	if(timer_state(ptmr) == RTOS_TMR_STATE_UNUSED) {
 		*perr = RTOS_ERR_TMR_INACTIVE;
 		return RTOS_FALSE;
 	}
 
 	*perr = RTOS_SUCCESS;
 	// Return the Pointer to the String
-	return ptmr->RTOSTmrName;	
+	return timer_cold(ptmr)->RTOSTmrName;
 }
 
 // To Get the Number of ticks remaining in time out
-INT32U RTOSTmrRemainGet(RTOS_TMR *ptmr, INT8U *perr)
+INT64U RTOSTmrRemainGet(RTOS_TMR *ptmr, INT8U *perr)
 {
+	INT64U tick;
+	INT64U match;
+	INT8U state;
+
 	// ERROR Checking
 	if(ptmr == NULL) {
 		*perr = RTOS_ERR_TMR_INVALID;
@@ -164,14 +324,28 @@ INT32U RTOSTmrRemainGet(RTOS_TMR *ptmr, INT8U *perr)
 		return 0;
 	}
 
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_UNUSED) {
+	if(timer_state(ptmr) == RTOS_TMR_STATE_UNUSED) {
 		*perr = RTOS_ERR_TMR_INACTIVE;
 		return 0;
 	}
 
 	*perr = RTOS_SUCCESS;
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_RUNNING) {
-		return (ptmr->RTOSTmrMatch - RTOSTmrTickCtr);
+	state = __atomic_load_n(&ptmr->RTOSTmrState, __ATOMIC_SEQ_CST);
+
+	if((state & RTOS_TMR_STATE_MASK) == RTOS_TMR_STATE_RUNNING) {
+		tick = get_current_tick();
+		match = __atomic_load_n(&ptmr->RTOSTmrMatch, __ATOMIC_RELAXED);
+
+		// Start still in the Mailbox of the owning Shard, count from the Tick it was posted at
+		if((state & RTOS_TMR_STATE_MSG) != 0) {
+			match = timer_first_match(timer_cold(ptmr), timer_start_tick(timer_cold(ptmr), tick));
+		}
+
+		// Due but not yet processed by the Timer Task
+		if(match <= tick) {
+			return 0;
+		}
+		return match - tick;
 	}
 	else {
 		return 0;
@@ -193,59 +367,37 @@ INT8U RTOSTmrStateGet(RTOS_TMR *ptmr, INT8U *perr)
 	}
 
 	*perr = RTOS_SUCCESS;
-	return ptmr->RTOSTmrState;
+	return timer_state(ptmr);
 }
 
 // Function to start a Timer
 INT8U RTOSTmrStart(RTOS_TMR *ptmr, INT8U *perr)
 {
+	TIMER_SHARD *shard;
+
 	if(ptmr->RTOSTmrType != RTOS_TMR_TYPE) {
 		*perr = RTOS_ERR_TMR_INVALID_TYPE;
 		return RTOS_FALSE;
 	}
 
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_UNUSED) {
+	if(timer_state(ptmr) == RTOS_TMR_STATE_UNUSED) {
 		*perr = RTOS_ERR_TMR_INACTIVE;
 		return RTOS_FALSE;
 	}
-	else if((ptmr->RTOSTmrState == RTOS_TMR_STATE_STOPPED) || (ptmr->RTOSTmrState == RTOS_TMR_STATE_COMPLETED)) {
-		if(ptmr->RTOSTmrOpt == RTOS_TMR_ONE_SHOT) {
-			// For One Shot Timer
-			ptmr->RTOSTmrMatch = RTOSTmrTickCtr + ptmr->RTOSTmrDelay;
 
-			insert_hash_entry(ptmr);
-		}
-		else {
-			// For Periodic Timer
-			if(ptmr->RTOSTmrDelay <= 0) {
-				// Fill up the Time = Period
-				ptmr->RTOSTmrMatch = RTOSTmrTickCtr + ptmr->RTOSTmrPeriod;
-			}
-			else {
-				// Fill up the Time = Delay
-				ptmr->RTOSTmrMatch = RTOSTmrTickCtr + ptmr->RTOSTmrDelay;
-			}
-			insert_hash_entry(ptmr);
-		}
-		ptmr->RTOSTmrState = RTOS_TMR_STATE_RUNNING;
-	}
-	else if(ptmr->RTOSTmrState == RTOS_TMR_STATE_RUNNING) {
-		// No need to make any changes as it is already active
-		// Do Nothing
-	}
-	else {
-		// Invalid State
-		*perr = RTOS_ERR_TMR_INVALID_STATE;
-		return RTOS_FALSE;
-	}
+	// The Timer always goes in the Wheel of its own Shard
+	shard = timer_shard(ptmr);
 
-	*perr = RTOS_SUCCESS;
-	return RTOS_TRUE;
+	*perr = timer_command(shard, ptmr, RTOS_TMR_BATCH_START, get_current_tick());
+
+	return (*perr == RTOS_SUCCESS) ? RTOS_TRUE : RTOS_FALSE;
 }
 
 // Function to Stop the Timer
 INT8U RTOSTmrStop(RTOS_TMR *ptmr, INT8U opt, void *callback_arg, INT8U *perr)
 {
+	TIMER_SHARD *shard;
+
 	// ERROR Checking
 	if(ptmr == NULL) {
 		*perr = RTOS_ERR_TMR_INVALID;
@@ -257,7 +409,7 @@ INT8U RTOSTmrStop(RTOS_TMR *ptmr, INT8U opt, void *callback_arg, INT8U *perr)
 		return RTOS_FALSE;
 	}
 
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_UNUSED) {
+	if(timer_state(ptmr) == RTOS_TMR_STATE_UNUSED) {
 		*perr = RTOS_ERR_TMR_INACTIVE;
 		return RTOS_FALSE;
 	}
@@ -267,16 +419,22 @@ INT8U RTOSTmrStop(RTOS_TMR *ptmr, INT8U opt, void *callback_arg, INT8U *perr)
 		return RTOS_FALSE;
 	}
 
-	if(ptmr->RTOSTmrState == RTOS_TMR_STATE_STOPPED) {
-		*perr = RTOS_ERR_TMR_STOPPED;
-		return RTOS_FALSE;
-	}
+	shard = timer_shard(ptmr);
 
-	// Remove the Timer from the Hash Table List
-	remove_hash_entry(ptmr);
+	if(RTOSTmrCfg.RTOSTmrLazyCancel == RTOS_TRUE) {
+		// Leave the Timer in the Wheel as a Tombstone, the Timer Task drops it when it gets there
+		if(timer_state_claim(ptmr, RTOS_TMR_STATE_STOPPED, perr, NULL) == RTOS_FALSE) {
+			return RTOS_FALSE;
+		}
+	}
+	else {
+		// Unlink it now in the Timer Task of the Shard, else through the Mailbox of the Shard
+		*perr = timer_command(shard, ptmr, RTOS_TMR_BATCH_STOP, 0);
 
-	// Change the State to Stopped
-	ptmr->RTOSTmrState = RTOS_TMR_STATE_STOPPED;
+		if(*perr != RTOS_SUCCESS) {
+			return RTOS_FALSE;
+		}
+	}
 
 	switch(opt) {
 		case RTOS_TMR_OPT_NONE:
@@ -285,340 +443,3549 @@ INT8U RTOSTmrStop(RTOS_TMR *ptmr, INT8U opt, void *callback_arg, INT8U *perr)
 
 		case RTOS_TMR_OPT_CALLBACK:
 			// Execute the Callback Function
-			ptmr->RTOSTmrCallback(ptmr->RTOSTmrCallbackArg);
+			timer_cold(ptmr)->RTOSTmrCallback(timer_cold(ptmr)->RTOSTmrCallbackArg);
 			break;
 
 		case RTOS_TMR_OPT_CALLBACK_ARG:
 			// Execute the Callback Function with given Argument
-			ptmr->RTOSTmrCallback(callback_arg);
+			timer_cold(ptmr)->RTOSTmrCallback(callback_arg);
 			break;
 	}
+
+	*perr = RTOS_SUCCESS;
+	return RTOS_TRUE;
 }
 
-// Function called when OS Tick Interrupt Occurs which will signal the RTOSTmrTask() to update the Timers
-void RTOSTmrSignal(int signum)
+// Function to start a Batch of Timers, locking each Shard once, returns the Number of Timers started
+INT32U RTOSTmrStartBatch(RTOS_TMR **ptmrs, INT32U count, INT8U *perrs)
 {
-	// Received the OS Tick
-	// Send the Signal to Timer Task
-	sem_post(&timer_task_sem);
-}
+	if((ptmrs == NULL) || (perrs == NULL)) {
+		return 0;
+	}
 
-/*****************************************************
- * Internal Functions
- *****************************************************
- */
+	return timer_batch(ptmrs, count, RTOS_TMR_BATCH_START, perrs);
+}
 
-// Create Pool of Timers
-INT8U Create_Timer_Pool(INT32U timer_count)
+// Function to Stop a Batch of Timers, locking each Shard once, returns the Number of Timers stopped
+INT32U RTOSTmrStopBatch(RTOS_TMR **ptmrs, INT32U count, INT8U opt, void *callback_arg, INT8U *perrs)
 {
-	int i;
-	RTOS_TMR *current_ptr;
-	RTOS_TMR *temp_ptr;
+	INT32U i;
+	INT32U done;
 
-	FreeTmrCount = timer_count;
-	for(i = 0; i < timer_count; i++) {	
-		// Create a Timer Object
-		temp_ptr = (RTOS_TMR*) malloc(sizeof(RTOS_TMR));
-		
-		if(temp_ptr == NULL) {
-			return RTOS_MALLOC_ERR;
+	if((ptmrs == NULL) || (perrs == NULL)) {
+		return 0;
+	}
+
+	if((opt != RTOS_TMR_OPT_NONE) && (opt != RTOS_TMR_OPT_CALLBACK) && (opt != RTOS_TMR_OPT_CALLBACK_ARG)) {
+		for(i = 0; i < count; i++) {
+			perrs[i] = RTOS_ERR_TMR_INVALID_OPT;
+		}
+		return 0;
+	}
+
+	done = timer_batch(ptmrs, count, RTOS_TMR_BATCH_STOP, perrs);
+
+	// Callbacks run after every Shard is unlocked again
+	for(i = 0; (i < count) && (opt != RTOS_TMR_OPT_NONE); i++) {
+		if(perrs[i] != RTOS_SUCCESS) {
+			continue;
 		}
 
-		if(FreeTmrListPtr == NULL) {
-			FreeTmrListPtr = temp_ptr;
-			current_ptr = temp_ptr;
-			current_ptr->RTOSTmrNext = NULL;
-			current_ptr->RTOSTmrPrev = NULL;
+		if(opt == RTOS_TMR_OPT_CALLBACK) {
+			// Execute the Callback Function
+			timer_cold(ptmrs[i])->RTOSTmrCallback(timer_cold(ptmrs[i])->RTOSTmrCallbackArg);
 		}
 		else {
-			current_ptr->RTOSTmrNext = temp_ptr;
-			temp_ptr->RTOSTmrPrev = current_ptr;
-			temp_ptr->RTOSTmrNext = NULL;
-			current_ptr = temp_ptr;
+			// Execute the Callback Function with given Argument
+			timer_cold(ptmrs[i])->RTOSTmrCallback(callback_arg);
 		}
 	}
-	return RTOS_SUCCESS;
+
+	return done;
 }
 
-// Initialize the Hash Table
-void init_hash_table(void)
+// Function to Delete a Batch of Timers, locking each Shard once, returns the Number of Timers deleted
+INT32U RTOSTmrDelBatch(RTOS_TMR **ptmrs, INT32U count, INT8U *perrs)
 {
-	int i;
-
-	for(i = 0; i < HASH_TABLE_SIZE; i++) {
-		hash_table[i].timer_count = 0;
-		hash_table[i].list_ptr = NULL;
+	if((ptmrs == NULL) || (perrs == NULL)) {
+		return 0;
 	}
+
+	return timer_batch(ptmrs, count, RTOS_TMR_BATCH_DEL, perrs);
 }
 
-// Insert a Timer Object in the Hash Table
-void insert_hash_entry(RTOS_TMR *timer_obj)
+// Get the Handle of a Timer, it stays valid until the Timer is Deleted
+RTOS_TMR_HANDLE RTOSTmrHandleGet(RTOS_TMR *ptmr, INT8U *perr)
 {
-	INT8U index = 0;
+	// ERROR Checking
+	if(ptmr == NULL) {
+		*perr = RTOS_ERR_TMR_INVALID;
+		return RTOS_TMR_HANDLE_NONE;
+	}
 
-	index = timer_obj->RTOSTmrMatch % HASH_TABLE_SIZE;
-	
-	// Lock the Resources
-	pthread_mutex_lock(&hash_table_mutex);
-
-	// Incremnet the Counter
-	hash_table[index].timer_count++;
-
-	// Add the Entry
-	if(hash_table[index].list_ptr == NULL) {
-		// List is empty
-		// Add the first Element
-		hash_table[index].list_ptr = timer_obj;
-		timer_obj->RTOSTmrNext = NULL;
-		timer_obj->RTOSTmrPrev = NULL;
+	if(ptmr->RTOSTmrType != RTOS_TMR_TYPE) {
+		*perr = RTOS_ERR_TMR_INVALID_TYPE;
+		return RTOS_TMR_HANDLE_NONE;
 	}
-	else {
-		// List pointer contain some entries
-		// Add new entry
-		timer_obj->RTOSTmrNext = hash_table[index].list_ptr;
-		hash_table[index].list_ptr->RTOSTmrPrev = timer_obj;
-		hash_table[index].list_ptr = timer_obj;
-		timer_obj->RTOSTmrPrev = NULL;
+
+	if(timer_state(ptmr) == RTOS_TMR_STATE_UNUSED) {
+		*perr = RTOS_ERR_TMR_INACTIVE;
+		return RTOS_TMR_HANDLE_NONE;
 	}
 
-	// Unlock the Resources
-	pthread_mutex_unlock(&hash_table_mutex);
+	*perr = RTOS_SUCCESS;
+	return ((RTOS_TMR_HANDLE)__atomic_load_n(&timer_cold(ptmr)->RTOSTmrGen, __ATOMIC_ACQUIRE) << 32) | ptmr->RTOSTmrIndex;
 }
 
-// Remove the Timer Object entry from the Hash Table
-void remove_hash_entry(RTOS_TMR *timer_obj)
+// Function to Stop the Timer of a Handle, RTOS_ERR_TMR_STALE once the Timer was Deleted
+INT8U RTOSTmrHandleStop(RTOS_TMR_HANDLE handle, INT8U opt, void *callback_arg, INT8U *perr)
 {
-	INT8U index = 0;
+	INT8U	retVal;
+	RTOS_TMR *ptmr = timer_handle_pin(handle, perr);
 
-	index = timer_obj->RTOSTmrMatch % HASH_TABLE_SIZE;
+	if(ptmr == NULL) {
+		return RTOS_FALSE;
+	}
 
-	// Lock the Resources
-	pthread_mutex_lock(&hash_table_mutex);
+	retVal = RTOSTmrStop(ptmr, opt, callback_arg, perr);
 
-	if(timer_obj->RTOSTmrPrev == NULL) {
-		// Its First Entry
-		hash_table[index].list_ptr = timer_obj->RTOSTmrNext;
+	// Deleted since the Handle was checked, the Pin kept the Timer from being reused meanwhile
+	if(*perr == RTOS_ERR_TMR_INACTIVE) {
+		*perr = RTOS_ERR_TMR_STALE;
+	}
 
-		if(hash_table[index].list_ptr != NULL) {
-			hash_table[index].list_ptr->RTOSTmrPrev = NULL;
-		}
+	timer_handle_unpin(ptmr);
+	return retVal;
+}
 
-		timer_obj->RTOSTmrNext = NULL;
-		timer_obj->RTOSTmrPrev = NULL;
+// Function to Delete the Timer of a Handle, RTOS_ERR_TMR_STALE once the Timer was Deleted
+INT8U RTOSTmrHandleDel(RTOS_TMR_HANDLE handle, INT8U *perr)
+{
+	INT8U	retVal;
+	RTOS_TMR *ptmr = timer_handle_pin(handle, perr);
+
+	if(ptmr == NULL) {
+		return RTOS_FALSE;
 	}
-	else {
-		timer_obj->RTOSTmrPrev->RTOSTmrNext = timer_obj->RTOSTmrNext;
 
-		if(timer_obj->RTOSTmrNext != NULL) {
-			timer_obj->RTOSTmrNext->RTOSTmrPrev = timer_obj->RTOSTmrPrev;
-		}
+	retVal = RTOSTmrDel(ptmr, perr);
 
-		timer_obj->RTOSTmrNext = NULL;
-		timer_obj->RTOSTmrPrev = NULL;
+	if(*perr == RTOS_ERR_TMR_INACTIVE) {
+		*perr = RTOS_ERR_TMR_STALE;
 	}
 
-	// Decrement the Counter
-	hash_table[index].timer_count--;
-
-	// Unlock the Resources
-	pthread_mutex_unlock(&hash_table_mutex);
+	timer_handle_unpin(ptmr);
+	return retVal;
 }
 
-// Timer Task to Manage the Running Timers
-void *RTOSTmrTask(void *temp)
+// To Get the Number of ticks remaining in time out of the Timer of a Handle
+INT64U RTOSTmrHandleRemainGet(RTOS_TMR_HANDLE handle, INT8U *perr)
 {
-	INT8U index = 0;
-	RTOS_TMR *temp_timer = NULL;
-	RTOS_TMR *next_timer = NULL;
-
-	while(1) {
-		// Wait for the signal from RTOSTmrSignal()
-		sem_wait(&timer_task_sem);
+	INT64U	remain;
+	RTOS_TMR *ptmr = timer_handle_pin(handle, perr);
 
-		// Once got the signal, Increment the Counter
-		RTOSTmrTickCtr++;
+	if(ptmr == NULL) {
+		return 0;
+	}
 
-		//fprintf(stdout, "\nGot Sem Signal....%d", RTOSTmrTickCtr);
-		// Check the whole List associated with the index of the Hash Table
-		index = RTOSTmrTickCtr % HASH_TABLE_SIZE;
+	remain = RTOSTmrRemainGet(ptmr, perr);
 
-		temp_timer = hash_table[index].list_ptr;
-		
-		if(temp_timer == NULL) {
-			// No Entries in the List
-			// Nothing to do
-		}
-		else {
-			while(temp_timer != NULL) {
-				if(temp_timer->RTOSTmrMatch == RTOSTmrTickCtr) {
-					next_timer = temp_timer->RTOSTmrNext;
-					
-					// call the Callback function
-					temp_timer->RTOSTmrCallback(temp_timer->RTOSTmrCallbackArg);
-
-					// First Remove the Entry from Hash Table List
-					remove_hash_entry(temp_timer);
-
-					// Check whether timer is periodic
-					if(temp_timer->RTOSTmrOpt == RTOS_TMR_PERIODIC) {
-						// Again Add the Timer in the Hash Table
-						// Fill up the Time = Period
-						temp_timer->RTOSTmrMatch = RTOSTmrTickCtr + temp_timer->RTOSTmrPeriod;
-
-						insert_hash_entry(temp_timer);
-					}
-					else {
-						temp_timer->RTOSTmrState = RTOS_TMR_STATE_COMPLETED;
-					}
-
-					// Continue Checking the next list
-					temp_timer = next_timer;
-				}
-				else {
-					temp_timer = temp_timer->RTOSTmrNext;
-				}
-			}
-		
-		}
-		index = 0;
-		temp_timer = next_timer = NULL;
+	if(*perr == RTOS_ERR_TMR_INACTIVE) {
+		*perr = RTOS_ERR_TMR_STALE;
 	}
-	return temp;
+
+	timer_handle_unpin(ptmr);
+	return remain;
 }
 
-// Timer Initialization Function
-void RTOSTmrInit(void)
+// To Get a Snapshot of the Timer Manager Statistics, the Counters are read without any Timer Lock
+INT8U RTOSTmrStatsGet(RTOS_TMR_STATS *pstats, INT8U *perr)
 {
-	INT32U timer_count = 0;
-	INT8U	retVal;
-	pthread_attr_t attr;
-
-	fprintf(stdout,"\n\nHere Enter the number of Timers required in the Pool for the RTOS\n");
-	fprintf(stdout,"Timers = ");
-	scanf("%d", &timer_count);
+	INT32U i;
+	INT32U j;
+	TIMER_SHARD *shard;
 
-	retVal = Create_Timer_Pool(timer_count);
-
-	if(retVal == RTOS_SUCCESS) {
-		fprintf(stdout, "\nOkay %d Timers Created Successfully in the Pool for the RTOS", timer_count);
+	if(pstats == NULL) {
+		*perr = RTOS_ERR_TMR_INVALID;
+		return RTOS_FALSE;
 	}
-	else {
-		fprintf(stdout, "\nTimer pool could not be created due to the Memory Error");
+
+	if(RTOSTmrInitDone == RTOS_FALSE) {
+		*perr = RTOS_ERR_TMR_INVALID_STATE;
+		return RTOS_FALSE;
 	}
 
-	// Init Hash Table
-	init_hash_table();
+	memset(pstats, 0, sizeof(RTOS_TMR_STATS));
 
-	fprintf(stdout, "\n\nHash Table Initialized Successfully\n");
+	// Armed Timers and Tick Processing of every Shard
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		shard = &timer_shards[i];
 
-	// Initialize Semaphore
-	sem_init(&timer_task_sem, 0, 0);
+		for(j = 0; j < RTOS_TMR_WHEEL_LEVELS; j++) {
+			pstats->RTOSTmrArmed[j] += __atomic_load_n(&shard->wheel.timer_count[j], __ATOMIC_RELAXED);
+		}
+		pstats->RTOSTmrArmed[RTOS_TMR_WHEEL_LEVELS] += __atomic_load_n(&shard->wheel.overflow_count, __ATOMIC_RELAXED);
+		pstats->RTOSTmrArmed[0] += __atomic_load_n(&shard->wheel.queue_count, __ATOMIC_RELAXED);
 
-	// Initialize Mutex
-	pthread_mutex_init (&hash_table_mutex, NULL);
-	pthread_mutex_init (&timer_pool_mutex, NULL);
+		pstats->RTOSTmrTickBusyCount += __atomic_load_n(&shard->tick_busy_count, __ATOMIC_RELAXED);
+		pstats->RTOSTmrTickBusyNs += __atomic_load_n(&shard->tick_busy_ns, __ATOMIC_RELAXED);
 
-	// Initialize the pthread Attributes
-	pthread_attr_init (&attr);
+		if(__atomic_load_n(&shard->tick_busy_max_ns, __ATOMIC_RELAXED) > pstats->RTOSTmrTickBusyMaxNs) {
+			pstats->RTOSTmrTickBusyMaxNs = __atomic_load_n(&shard->tick_busy_max_ns, __ATOMIC_RELAXED);
+		}
 
-	// Create Thread
-	pthread_create (&thread, &attr, &RTOSTmrTask, NULL);
+#if RTOS_CFG_TMR_STATS
+		pstats->RTOSTmrFired += __atomic_load_n(&shard->fired, __ATOMIC_RELAXED);
 
-	fprintf(stdout,"\nRTOS Initialization Done...\n");
-}
+		for(j = 0; j < RTOS_TMR_STATS_HIST; j++) {
+			pstats->RTOSTmrLateness[j] += __atomic_load_n(&shard->lateness[j], __ATOMIC_RELAXED);
+		}
+#endif
+	}
 
-// Allocate a timer object from free timer pool
-RTOS_TMR* alloc_timer_obj(void)
-{
-	RTOS_TMR *temp_ptr = NULL;
+	// Pool Usage
+	pstats->RTOSTmrPoolTotal = __atomic_load_n(&TmrPoolSize, __ATOMIC_RELAXED);
+	pstats->RTOSTmrPoolFree = __atomic_load_n(&FreeTmrCount, __ATOMIC_RELAXED);
+	pstats->RTOSTmrPoolHighWater = __atomic_load_n(&TmrPoolHighWater, __ATOMIC_RELAXED);
 
-	// Lock the Resources
-	pthread_mutex_lock(&timer_pool_mutex);
-	
-	// Check for Availability of Timers
-	if(FreeTmrCount <= 0 || FreeTmrListPtr == NULL) {
-		// No timers left
-		// Unlock the Resources
-		pthread_mutex_unlock(&timer_pool_mutex);
+#if RTOS_CFG_TMR_STATS
+	{
+		INT64U allocs = __atomic_load_n(&RTOSTmrStatsAllocs, __ATOMIC_RELAXED);
+		INT64U frees = __atomic_load_n(&RTOSTmrStatsFrees, __ATOMIC_RELAXED);
 
-		return NULL;
-	}	
+		for(i = 0; i < RTOS_TMR_STATS_THREADS; i++) {
+			allocs += __atomic_load_n(&RTOSTmrStatsSlot[i].allocs, __ATOMIC_RELAXED);
+			frees += __atomic_load_n(&RTOSTmrStatsSlot[i].frees, __ATOMIC_RELAXED);
+		}
 
-	// Assign the Pointer from Top
-	temp_ptr = FreeTmrListPtr;
+		// Counters of different Threads are read at slightly different times
+		pstats->RTOSTmrPoolUsed = (allocs > frees) ? (allocs - frees) : 0;
+	}
 
-	FreeTmrListPtr = FreeTmrListPtr->RTOSTmrNext;
+	// The Name is copied under its Lock so it matches the Time
+	pthread_mutex_lock(&timer_stats_mutex);
+	pstats->RTOSTmrCallbackMaxNs = __atomic_load_n(&RTOSTmrStatsCbMaxNs, __ATOMIC_RELAXED);
+	memcpy(pstats->RTOSTmrCallbackMaxName, RTOSTmrStatsCbMaxName, RTOS_TMR_STATS_NAME_LEN);
+	pthread_mutex_unlock(&timer_stats_mutex);
+#endif
 
-	if(FreeTmrListPtr != NULL) {
-		FreeTmrListPtr->RTOSTmrPrev = NULL;
-	}
+	pstats->RTOSTmrCallbackOverruns = __atomic_load_n(&RTOSTmrOverruns, __ATOMIC_RELAXED);
+	pstats->RTOSTmrCallbackDemoted = __atomic_load_n(&RTOSTmrDemoted, __ATOMIC_RELAXED);
 
-	temp_ptr->RTOSTmrPrev = NULL;
-	temp_ptr->RTOSTmrNext = NULL;
+	// Callbacks waiting in the Executor Queue
+	if(RTOSTmrCfg.RTOSTmrExecThreads > 0) {
+		INT64U enqueue_pos = __atomic_load_n(&exec_queue.enqueue_pos, __ATOMIC_RELAXED);
+		INT64U dequeue_pos = __atomic_load_n(&exec_queue.dequeue_pos, __ATOMIC_RELAXED);
 
-	FreeTmrCount--;
+		pstats->RTOSTmrExecQueueDepth = (enqueue_pos > dequeue_pos) ? (enqueue_pos - dequeue_pos) : 0;
+	}
 
-	// Unlock the Resources
-	pthread_mutex_unlock(&timer_pool_mutex);
-	
-	return temp_ptr;
+	*perr = RTOS_SUCCESS;
+	return RTOS_TRUE;
 }
 
-// Free the allocated timer object and put it back into free pool
-void free_timer_obj(RTOS_TMR *ptmr)
+// To Get the Callback Watchdog Offenders, copies up to max Entries and returns their Number
+INT32U RTOSTmrOffendersGet(RTOS_TMR_OFFENDER *poffenders, INT32U max, INT8U *perr)
 {
-	// Lock the Resources
-	pthread_mutex_lock(&timer_pool_mutex);
+	INT32U count;
 
-	// Clear the Fields
-	ptmr->RTOSTmrCallback = NULL;
-	ptmr->RTOSTmrCallbackArg = NULL;
-	ptmr->RTOSTmrDelay = 0;
-	ptmr->RTOSTmrPeriod = 0;
-	ptmr->RTOSTmrName = NULL;
-	ptmr->RTOSTmrOpt = 0;
-	ptmr->RTOSTmrMatch = 0;
+	if((poffenders == NULL) && (max > 0)) {
+		*perr = RTOS_ERR_TMR_INVALID;
+		return 0;
+	}
 
-	// Change the State
-	ptmr->RTOSTmrState = RTOS_TMR_STATE_UNUSED;
+	pthread_mutex_lock(&timer_offender_mutex);
 
-	// Return the Timer to Free Timer Pool
-	ptmr->RTOSTmrNext = FreeTmrListPtr;
-	ptmr->RTOSTmrPrev = NULL;
+	count = (RTOSTmrOffenderCount < max) ? RTOSTmrOffenderCount : max;
 
-	if(FreeTmrListPtr != NULL) {
-		FreeTmrListPtr->RTOSTmrPrev = ptmr;
+	if(count > 0) {
+		memcpy(poffenders, RTOSTmrOffender, sizeof(RTOS_TMR_OFFENDER) * count);
 	}
 
-	FreeTmrListPtr = ptmr;
+	pthread_mutex_unlock(&timer_offender_mutex);
 
-	// Increment the Free Timer Counter
-	FreeTmrCount++;
+	*perr = RTOS_SUCCESS;
+	return count;
+}
 
-	// Unlock the Resources
-	pthread_mutex_unlock(&timer_pool_mutex);
-} 
+// Function called when OS Tick Interrupt Occurs which will signal the RTOSTmrTask() of every Shard to update the Timers
+void RTOSTmrSignal(int signum)
+{
+	INT32U i;
+	TIMER_SHARD *shards = __atomic_load_n(&timer_shards, __ATOMIC_ACQUIRE);
 
-// Function to Setup the Timer of Linux which will provide the Clock Tick Interrupt to the Timer Manager Module
-void OSTickInitialize(void) {	
-	timer_t timer_id;
-	struct itimerspec time_value;
+	// Received the OS Tick
+	// Send the Signal to the Timer Task of every Shard, none before RTOSTmrInit() made them
+	if(shards == NULL) {
+		return;
+	}
 
-	// Setup the time of the OS Tick as 100 ms after 3 sec of Initial Delay
-	time_value.it_interval.tv_sec = 0;
-	time_value.it_interval.tv_nsec = RTOS_CFG_TMR_TASK_RATE;
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		sem_post(&shards[i].task_sem);
+	}
+}
 
-	time_value.it_value.tv_sec = 0;
-	time_value.it_value.tv_nsec = RTOS_CFG_TMR_TASK_RATE;
+/*****************************************************
+ * Internal Functions
+ *****************************************************
+ */
 
-	// Change the Action of SIGALRM to call a function RTOSTmrSignal()
-	signal(SIGALRM, &RTOSTmrSignal);
+// Create a Timer owned by the given Shard
+RTOS_TMR* create_timer_obj(INT64U delay, INT64U period, INT8U option, INT32U shard, RTOS_TMR_CALLBACK callback,
+	void *callback_arg, INT8 *name, INT8U *err)
+{
+	RTOS_TMR *timer_obj = NULL;
+	RTOS_TMR_COLD *timer_cold_obj;
+	
+	// Check Option validity
+	if((option & ~(RTOS_TMR_OPT_TYPE_MASK | RTOS_TMR_FLAG_INLINE)) != 0) {
+		*err = RTOS_ERR_TMR_INVALID_OPT;
+		return NULL;
+	}
+
+	if(((option & RTOS_TMR_OPT_TYPE_MASK) != RTOS_TMR_ONE_SHOT) && ((option & RTOS_TMR_OPT_TYPE_MASK) != RTOS_TMR_PERIODIC)) {
+		*err = RTOS_ERR_TMR_INVALID_OPT;
+		return NULL;
+	}
+
+	// Check delay and period validity
+	if((option & RTOS_TMR_OPT_TYPE_MASK) == RTOS_TMR_ONE_SHOT) {
+		if(delay <= 0) {
+			*err = RTOS_ERR_TMR_INVALID_DLY;
+			return NULL;
+		}
+	}
+	else {
+		if((period <= 0) || (delay < 0)) {
+			*err = RTOS_ERR_TMR_INVALID_DLY;
+			return NULL;
+		}
+	}
+
+	// Allocate a Timer
+	timer_obj = alloc_timer_obj();
+
+	if(timer_obj == NULL) {
+		// Timers are not available
+		*err = RTOS_ERR_TMR_NON_AVAIL;
+		return NULL;
+	}
+
+	// Fill up the Timer Object
+	timer_cold_obj = timer_cold(timer_obj);
+
+	timer_cold_obj->RTOSTmrCallback = callback;
+	timer_cold_obj->RTOSTmrCallbackArg = callback_arg;
+	timer_cold_obj->RTOSTmrDelay = delay;
+	timer_cold_obj->RTOSTmrPeriod = period;
+	timer_cold_obj->RTOSTmrName = name;
+	timer_cold_obj->RTOSTmrOpt = option;
+	timer_cold_obj->RTOSTmrShard = shard;
+	timer_cold_obj->RTOSTmrMiss = RTOSTmrCfg.RTOSTmrMissPolicy;
+	timer_cold_obj->RTOSTmrSlackShift = 0;
+	timer_cold_obj->RTOSTmrLag = 0;
+	timer_node(timer_obj)->RTOSTmrOverruns = 0;
+
+	timer_obj->RTOSTmrType = RTOS_TMR_TYPE;
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+	__atomic_store_n(&timer_obj->RTOSTmrState, RTOS_TMR_STATE_STOPPED, __ATOMIC_SEQ_CST);
+
+	*err = RTOS_SUCCESS;
+
+	return timer_obj;
+}
+
+// Create Pool of Timers
+INT8U Create_Timer_Pool(INT32U timer_count)
+{
+	if(timer_count == 0) {
+		// Pool will be grown on the first Create
+		return RTOS_SUCCESS;
+	}
+
+	return grow_timer_pool(timer_count);
+}
+
+// Add a Slab Region of at least timer_count Timers to the Pool (Pool Mutex must be held or Pool not yet shared)
+INT8U grow_timer_pool(INT32U timer_count)
+{
+	INT32U i;
+	INT32U chunks;
+	INT32U first_index;
+	INT64U size;
+	void *base = NULL;
+	INT8U mapped = RTOS_FALSE;
+	RTOS_TMR *slab;
+
+	// Whole Chunks only
+	chunks = (timer_count + RTOS_TMR_SLAB_MASK) >> RTOS_TMR_SLAB_SHIFT;
+	first_index = TmrPoolSize;
+
+	if((TmrSlabCount >= RTOS_TMR_SLAB_MAX_REGIONS) || (chunks > (RTOS_TMR_SLAB_MAX_CHUNKS - (first_index >> RTOS_TMR_SLAB_SHIFT)))) {
+		return RTOS_MALLOC_ERR;
+	}
+
+	size = (INT64U)chunks * RTOS_TMR_SLAB_CHUNK * (sizeof(RTOS_TMR) + sizeof(RTOS_TMR_COLD) + sizeof(RTOS_TMR_NODE));
+
+#if RTOS_CFG_STATIC
+	// The static Slab is the one and only Region
+	if((TmrSlabCount > 0) || (size > sizeof(TmrStaticSlab))) {
+		return RTOS_MALLOC_ERR;
+	}
+
+	base = TmrStaticSlab;
+	chunks = RTOS_CFG_STATIC_POOL >> RTOS_TMR_SLAB_SHIFT;
+	size = sizeof(TmrStaticSlab);
+#else
+	if(RTOSTmrCfg.RTOSTmrHugePages == RTOS_TRUE) {
+		// Round up to whole Huge Pages and try the Huge Page Pool first, else ask for Transparent Huge Pages
+		size = (size + RTOS_TMR_HUGE_PAGE - 1) & ~((INT64U)RTOS_TMR_HUGE_PAGE - 1);
+
+		base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+		if(base == MAP_FAILED) {
+			base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if(base == MAP_FAILED) {
+				return RTOS_MALLOC_ERR;
+			}
+			madvise(base, size, MADV_HUGEPAGE);
+		}
+		mapped = RTOS_TRUE;
+
+		// Use the whole rounded Region if it still fits the Chunk Table
+		if((size / (RTOS_TMR_SLAB_CHUNK * (sizeof(RTOS_TMR) + sizeof(RTOS_TMR_COLD) + sizeof(RTOS_TMR_NODE))))
+			<= (RTOS_TMR_SLAB_MAX_CHUNKS - (first_index >> RTOS_TMR_SLAB_SHIFT))) {
+			chunks = size / (RTOS_TMR_SLAB_CHUNK * (sizeof(RTOS_TMR) + sizeof(RTOS_TMR_COLD) + sizeof(RTOS_TMR_NODE)));
+		}
+	}
+	else if(posix_memalign(&base, RTOS_TMR_CACHE_LINE, size) != 0) {
+		return RTOS_MALLOC_ERR;
+	}
+
+	// Every Heap has to hold the grown Pool before its Timers can be Started
+	if(heap_reserve(first_index + (chunks << RTOS_TMR_SLAB_SHIFT)) != RTOS_SUCCESS) {
+		if(mapped == RTOS_TRUE) {
+			munmap(base, size);
+		}
+		else {
+			free(base);
+		}
+		return RTOS_MALLOC_ERR;
+	}
+#endif
+
+	TmrSlab[TmrSlabCount].base = base;
+	TmrSlab[TmrSlabCount].size = size;
+	TmrSlab[TmrSlabCount].mapped = mapped;
+	TmrSlabCount++;
+
+	// Each Chunk is its Hot Records followed by its Cold Records and its Queue Nodes
+	for(i = 0; i < chunks; i++) {
+		slab = (RTOS_TMR*) ((INT8U*)base
+			+ ((INT64U)i * RTOS_TMR_SLAB_CHUNK * (sizeof(RTOS_TMR) + sizeof(RTOS_TMR_COLD) + sizeof(RTOS_TMR_NODE))));
+
+		TmrSlabChunk[(first_index >> RTOS_TMR_SLAB_SHIFT) + i] = slab;
+		TmrSlabColdChunk[(first_index >> RTOS_TMR_SLAB_SHIFT) + i] = (RTOS_TMR_COLD*) &slab[RTOS_TMR_SLAB_CHUNK];
+		TmrSlabNodeChunk[(first_index >> RTOS_TMR_SLAB_SHIFT) + i] =
+			(RTOS_TMR_NODE*) &TmrSlabColdChunk[(first_index >> RTOS_TMR_SLAB_SHIFT) + i][RTOS_TMR_SLAB_CHUNK];
+	}
+
+	// Link the new Timers in Index order, so the Free Stack hands them out sequentially
+	for(i = 0; i < (chunks << RTOS_TMR_SLAB_SHIFT); i++) {
+		slab = timer_from_index(first_index + i);
+
+		slab->RTOSTmrType = 0;
+		slab->RTOSTmrState = RTOS_TMR_STATE_UNUSED;
+		slab->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+		slab->RTOSTmrIndex = first_index + i;
+		slab->RTOSTmrPrev = NULL;
+		slab->RTOSTmrNext = (i + 1 < (chunks << RTOS_TMR_SLAB_SHIFT)) ? timer_from_index(first_index + i + 1) : NULL;
+
+		timer_cold(slab)->RTOSTmrGen = TmrPoolGenBase;
+		timer_cold(slab)->RTOSTmrPins = 0;
+	}
+
+	// Publish the new Size before any of the Timers become reachable from the Free Stack
+	__atomic_store_n(&TmrPoolSize, first_index + (chunks << RTOS_TMR_SLAB_SHIFT), __ATOMIC_RELEASE);
+
+	free_stack_push(timer_from_index(first_index), timer_from_index(first_index + (chunks << RTOS_TMR_SLAB_SHIFT) - 1),
+		chunks << RTOS_TMR_SLAB_SHIFT);
+
+	return RTOS_SUCCESS;
+}
+
+// Give every Slab Region back, no Timer may be in use
+void Destroy_Timer_Pool(void)
+{
+	INT32U i;
+	INT32U gen;
+	INT32U last = TmrPoolGenBase;
+
+	// Latest Generation of the Pool, Generations wrap so they are compared by their Distance from the Base
+	for(i = 0; i < TmrPoolSize; i++) {
+		gen = timer_cold(timer_from_index(i))->RTOSTmrGen;
+
+		if((INT32U)(gen - TmrPoolGenBase) > (INT32U)(last - TmrPoolGenBase)) {
+			last = gen;
+		}
+	}
+
+	// Generation 0 is never used
+	TmrPoolGenBase = (last + 1 == 0) ? 1 : last + 1;
+
+#if !RTOS_CFG_STATIC
+	for(i = 0; i < TmrSlabCount; i++) {
+		if(TmrSlab[i].mapped == RTOS_TRUE) {
+			munmap(TmrSlab[i].base, TmrSlab[i].size);
+		}
+		else {
+			free(TmrSlab[i].base);
+		}
+	}
+#endif
+
+	TmrSlabCount = 0;
+	TmrPoolSize = 0;
+	FreeTmrCount = 0;
+	FreeTmrStackHead = 0;
+
+#if RTOS_CFG_TMR_STATS
+	// No Timer is used any more, the Allocation Counters of the next Pool start from 0 (the Slots stay with their Threads)
+	for(i = 0; i < RTOS_TMR_STATS_THREADS; i++) {
+		__atomic_store_n(&RTOSTmrStatsSlot[i].allocs, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&RTOSTmrStatsSlot[i].frees, 0, __ATOMIC_RELAXED);
+	}
+	__atomic_store_n(&RTOSTmrStatsAllocs, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&RTOSTmrStatsFrees, 0, __ATOMIC_RELAXED);
+#endif
+
+	// Timers still in the Thread Caches are gone with their Slabs
+	__atomic_add_fetch(&TmrPoolEpoch, 1, __ATOMIC_RELEASE);
+}
+
+// Get the Timer Object of a Pool Index
+RTOS_TMR* timer_from_index(INT32U index)
+{
+	return TmrSlabChunk[index >> RTOS_TMR_SLAB_SHIFT] + (index & RTOS_TMR_SLAB_MASK);
+}
+
+// Get the Cold Record of a Timer
+RTOS_TMR_COLD* timer_cold(RTOS_TMR *ptmr)
+{
+	return TmrSlabColdChunk[ptmr->RTOSTmrIndex >> RTOS_TMR_SLAB_SHIFT] + (ptmr->RTOSTmrIndex & RTOS_TMR_SLAB_MASK);
+}
+
+// Get the Queue Node of a Timer
+RTOS_TMR_NODE* timer_node(RTOS_TMR *ptmr)
+{
+	return TmrSlabNodeChunk[ptmr->RTOSTmrIndex >> RTOS_TMR_SLAB_SHIFT] + (ptmr->RTOSTmrIndex & RTOS_TMR_SLAB_MASK);
+}
+
+// Pin the Timer of a Handle without any Lock, so it is not reused until timer_handle_unpin(),
+// NULL when the Handle is invalid or its Timer was Deleted since
+RTOS_TMR* timer_handle_pin(RTOS_TMR_HANDLE handle, INT8U *perr)
+{
+	INT32U index = (INT32U)handle;
+	RTOS_TMR *ptmr;
+
+	// Generations start at 1, the Pool Size is published after the Chunk Tables
+	if(((handle >> 32) == 0) || (index >= __atomic_load_n(&TmrPoolSize, __ATOMIC_ACQUIRE))) {
+		*perr = RTOS_ERR_TMR_INVALID;
+		return NULL;
+	}
+
+	ptmr = timer_from_index(index);
+
+	// Pin before the Check, a Delete bumps the Generation before it looks at the Pins
+	__atomic_add_fetch(&timer_cold(ptmr)->RTOSTmrPins, 1, __ATOMIC_SEQ_CST);
+
+	// Freed (and maybe reused) since, or Deleted from another Shard and not yet freed
+	if((__atomic_load_n(&timer_cold(ptmr)->RTOSTmrGen, __ATOMIC_SEQ_CST) != (INT32U)(handle >> 32))
+		|| (timer_state(ptmr) == RTOS_TMR_STATE_UNUSED)) {
+		timer_handle_unpin(ptmr);
+		*perr = RTOS_ERR_TMR_STALE;
+		return NULL;
+	}
+	return ptmr;
+}
+
+// Drop a Pin of a Handle Call, the last one gives back a Timer Deleted under it
+void timer_handle_unpin(RTOS_TMR *ptmr)
+{
+	if(__atomic_sub_fetch(&timer_cold(ptmr)->RTOSTmrPins, 1, __ATOMIC_SEQ_CST) == RTOS_TMR_PIN_FREE) {
+		timer_pin_release(ptmr);
+	}
+}
+
+// Give a freed Timer back to the Pool once no Pin holds it, only the Thread which clears the Flag does
+void timer_pin_release(RTOS_TMR *ptmr)
+{
+	INT16U expected = RTOS_TMR_PIN_FREE;
+
+	if(__atomic_compare_exchange_n(&timer_cold(ptmr)->RTOSTmrPins, &expected, 0, RTOS_FALSE,
+		__ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+		timer_cache_put(ptmr);
+	}
+}
+
+// Create the Shards, each with its Timing Wheel, Lock, Condition and Semaphore, and map the CPUs to them
+INT8U init_timer_shards(void)
+{
+	INT32U i;
+	INT32U cpu;
+	INT32U allowed = 0;
+	INT32U allowed_cpu[CPU_SETSIZE];
+	TIMER_SHARD *shards;
+	pthread_condattr_t cond_attr;
+	cpu_set_t cpus;
+
+#if RTOS_CFG_STATIC
+	shards = TmrStaticShards;
+#else
+	if(posix_memalign((void**)&shards, RTOS_TMR_CACHE_LINE, sizeof(TIMER_SHARD) * RTOSTmrShardCount) != 0) {
+		return RTOS_MALLOC_ERR;
+	}
+#endif
+
+	// CPUs the Process may run on, the Shards are pinned to them in order
+	if((RTOSTmrCfg.RTOSTmrAffinity == RTOS_TRUE) && (sched_getaffinity(0, sizeof(cpus), &cpus) == 0)) {
+		for(cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if(CPU_ISSET(cpu, &cpus)) {
+				allowed_cpu[allowed++] = cpu;
+			}
+		}
+	}
+
+	// Without Affinity the CPUs simply spread over the Shards, else each CPU goes to the Shard pinned to it
+	for(cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		RTOSTmrCpuShard[cpu] = cpu % RTOS_TMR_SHARDS;
+	}
+
+	for(i = 0; i < allowed; i++) {
+		RTOSTmrCpuShard[allowed_cpu[i]] = i % RTOS_TMR_SHARDS;
+	}
+
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		init_timer_wheel(&shards[i]);
+
+		if(((RTOSTmrCfg.RTOSTmrQueue == RTOS_TMR_QUEUE_HEAP) && (heap_init(&shards[i]) != RTOS_SUCCESS))
+			|| ((RTOSTmrCfg.RTOSTmrQueue == RTOS_TMR_QUEUE_HASH) && (hash_init(&shards[i]) != RTOS_SUCCESS))) {
+			while(i-- > 0) {
+				heap_free(&shards[i]);
+				hash_free(&shards[i]);
+			}
+			shards_free(shards);
+			return RTOS_MALLOC_ERR;
+		}
+
+		shards[i].tick_ctr = 0;
+		shards[i].tick_busy_ns = 0;
+		shards[i].tick_busy_count = 0;
+		shards[i].tick_busy_max_ns = 0;
+		shards[i].fired = 0;
+		memset(shards[i].lateness, 0, sizeof(shards[i].lateness));
+		shards[i].id = i;
+		shards[i].cpu = (allowed > 0) ? (INT32)allowed_cpu[i % allowed] : -1;
+		shards[i].tick_fd = -1;
+		shards[i].mailbox = 0;
+
+		// Initialize Semaphore
+		sem_init(&shards[i].task_sem, 0, 0);
+
+		// Initialize Mutex
+		pthread_mutex_init (&shards[i].mutex, NULL);
+
+		// Initialize the Condition on the Monotonic Clock for the Tickless Deadlines
+		pthread_condattr_init (&cond_attr);
+		pthread_condattr_setclock (&cond_attr, CLOCK_MONOTONIC);
+		pthread_cond_init (&shards[i].cond, &cond_attr);
+		pthread_condattr_destroy (&cond_attr);
+	}
+
+	// Publish the Shards to RTOSTmrSignal() only once they are complete
+	__atomic_store_n(&timer_shards, shards, __ATOMIC_RELEASE);
+
+	return RTOS_SUCCESS;
+}
+
+// Free the Shard Array
+void shards_free(TIMER_SHARD *shards)
+{
+#if RTOS_CFG_STATIC
+	// The static Shards are never freed
+	(void)shards;
+#else
+	free(shards);
+#endif
+}
+
+// Initialize the Timing Wheel and the other Queues of a Shard
+void init_timer_wheel(TIMER_SHARD *shard)
+{
+	int level, i;
+
+	for(level = 0; level < RTOS_TMR_WHEEL_LEVELS; level++) {
+		shard->wheel.timer_count[level] = 0;
+
+		for(i = 0; i < RTOS_TMR_WHEEL_SIZE; i++) {
+			shard->wheel.slot[level][i] = NULL;
+		}
+
+		for(i = 0; i < (RTOS_TMR_WHEEL_SIZE / 64); i++) {
+			shard->wheel.bitmap[level][i] = 0;
+		}
+	}
+	shard->wheel.expired = NULL;
+	shard->wheel.overflow = NULL;
+	shard->wheel.overflow_count = 0;
+	shard->wheel.armed = 0;
+	shard->wheel.armed_valid = RTOS_FALSE;
+
+	shard->wheel.queue_count = 0;
+	memset(&shard->wheel.hash, 0, sizeof(shard->wheel.hash));
+	memset(&shard->wheel.hash_old, 0, sizeof(shard->wheel.hash_old));
+	shard->wheel.hash_rehash = 0;
+	shard->wheel.heap = NULL;
+	shard->wheel.heap_base = NULL;
+	shard->wheel.heap_size = 0;
+	shard->wheel.heap_spare = NULL;
+	shard->wheel.pairing = NULL;
+}
+
+// Get the List Head holding the Timer Object
+RTOS_TMR** wheel_list_head(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	if(timer_obj->RTOSTmrLevel == RTOS_TMR_WHEEL_EXPIRED) {
+		return &shard->wheel.expired;
+	}
+
+	if(timer_obj->RTOSTmrLevel == RTOS_TMR_WHEEL_OVERFLOW) {
+		return &shard->wheel.overflow;
+	}
+	return &shard->wheel.slot[timer_obj->RTOSTmrLevel][timer_obj->RTOSTmrSlot];
+}
+
+// Link the Timer Object in the Wheel Slot of its Match Tick (Owner of the Shard only)
+void wheel_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	INT64U delta;
+	INT8U level = 0;
+	INT8U index;
+	RTOS_TMR **head;
+
+	// Ticks left from the current Tick, the Level is the first one whose span covers it
+	delta = timer_obj->RTOSTmrMatch - shard->tick_ctr;
+
+	if(delta >= RTOS_TMR_WHEEL_SPAN) {
+		// Beyond the Top Level, wait in the Overflow List until the Tick Counter gets within reach
+		timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_OVERFLOW;
+		timer_obj->RTOSTmrNext = shard->wheel.overflow;
+		timer_obj->RTOSTmrPrev = NULL;
+
+		if(shard->wheel.overflow != NULL) {
+			shard->wheel.overflow->RTOSTmrPrev = timer_obj;
+		}
+		shard->wheel.overflow = timer_obj;
+		shard->wheel.overflow_count++;
+		return;
+	}
+
+	while((level < (RTOS_TMR_WHEEL_LEVELS - 1)) && ((delta >> ((level + 1) * RTOS_TMR_WHEEL_BITS)) != 0)) {
+		level++;
+	}
+
+	index = (timer_obj->RTOSTmrMatch >> (level * RTOS_TMR_WHEEL_BITS)) & RTOS_TMR_WHEEL_MASK;
+
+	timer_obj->RTOSTmrLevel = level;
+	timer_obj->RTOSTmrSlot = index;
+
+	// Add the Entry at the Head of the Slot List
+	head = &shard->wheel.slot[level][index];
+
+	timer_obj->RTOSTmrNext = *head;
+	timer_obj->RTOSTmrPrev = NULL;
+
+	if(*head != NULL) {
+		(*head)->RTOSTmrPrev = timer_obj;
+	}
+	*head = timer_obj;
+
+	// Mark the Slot as Non Empty and Increment the Counter
+	shard->wheel.bitmap[level][index >> 6] |= (1ULL << (index & 63));
+	shard->wheel.timer_count[level]++;
+}
+
+// Unlink the Timer Object from the List holding it (Owner of the Shard only)
+void wheel_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	RTOS_TMR **head;
+	INT8U level = timer_obj->RTOSTmrLevel;
+	INT8U index = timer_obj->RTOSTmrSlot;
+
+	if(level == RTOS_TMR_WHEEL_NONE) {
+		// Already Unlinked (e.g. One Shot Timer just expired)
+		return;
+	}
+
+	head = wheel_list_head(shard, timer_obj);
+
+	if(timer_obj->RTOSTmrPrev == NULL) {
+		// Its First Entry
+		*head = timer_obj->RTOSTmrNext;
+	}
+	else {
+		timer_obj->RTOSTmrPrev->RTOSTmrNext = timer_obj->RTOSTmrNext;
+	}
+
+	if(timer_obj->RTOSTmrNext != NULL) {
+		timer_obj->RTOSTmrNext->RTOSTmrPrev = timer_obj->RTOSTmrPrev;
+	}
+
+	// Decrement the Counter and Mark the Slot Empty with its last Entry
+	if(level == RTOS_TMR_WHEEL_OVERFLOW) {
+		shard->wheel.overflow_count--;
+	}
+	else if(level < RTOS_TMR_WHEEL_LEVELS) {
+		shard->wheel.timer_count[level]--;
+
+		if(*head == NULL) {
+			shard->wheel.bitmap[level][index >> 6] &= ~(1ULL << (index & 63));
+		}
+	}
+
+	timer_obj->RTOSTmrNext = NULL;
+	timer_obj->RTOSTmrPrev = NULL;
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+}
+
+// Move the Timers of the current Slot of a Level down to the lower Levels (Owner of the Shard only)
+void wheel_cascade(TIMER_SHARD *shard, INT8U level)
+{
+	INT8U index;
+	RTOS_TMR *temp_timer;
+	RTOS_TMR *next_timer;
+
+	index = (shard->tick_ctr >> (level * RTOS_TMR_WHEEL_BITS)) & RTOS_TMR_WHEEL_MASK;
+
+	temp_timer = shard->wheel.slot[level][index];
+	shard->wheel.slot[level][index] = NULL;
+	shard->wheel.bitmap[level][index >> 6] &= ~(1ULL << (index & 63));
+
+	while(temp_timer != NULL) {
+		next_timer = temp_timer->RTOSTmrNext;
+		shard->wheel.timer_count[level]--;
+
+		if(timer_state(temp_timer) != RTOS_TMR_STATE_RUNNING) {
+			// Tombstone of a Stopped/Deleted Timer, drop it instead of carrying it down
+			temp_timer->RTOSTmrNext = NULL;
+			temp_timer->RTOSTmrPrev = NULL;
+			temp_timer->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+		}
+		else {
+			// Less than one span of this Level is left, so it always lands in a lower Level
+			wheel_link(shard, temp_timer);
+		}
+
+		temp_timer = next_timer;
+	}
+}
+
+// Link the Overflow Timers due within one Wheel Span in the Wheel (Owner of the Shard only)
+void wheel_refill_overflow(TIMER_SHARD *shard)
+{
+	RTOS_TMR *temp_timer;
+	RTOS_TMR *next_timer;
+
+	temp_timer = shard->wheel.overflow;
+
+	while(temp_timer != NULL) {
+		next_timer = temp_timer->RTOSTmrNext;
+
+		if(timer_state(temp_timer) != RTOS_TMR_STATE_RUNNING) {
+			// Tombstone of a Stopped/Deleted Timer
+			wheel_unlink(shard, temp_timer);
+		}
+		else if(temp_timer->RTOSTmrMatch - shard->tick_ctr < RTOS_TMR_WHEEL_SPAN) {
+			wheel_unlink(shard, temp_timer);
+			wheel_link(shard, temp_timer);
+		}
+
+		temp_timer = next_timer;
+	}
+}
+
+// Find the Ticks after the next Tick until a Slot has to be expired or cascaded (Owner of the Shard only)
+INT8U wheel_next_event(TIMER_SHARD *shard, INT64U *offset)
+{
+	INT8U level;
+	INT8U found = RTOS_FALSE;
+	INT64U base = shard->tick_ctr + 1;
+	INT32U start;
+	INT32U index;
+	INT32U word;
+	INT64U bits;
+	INT64U span;
+	INT64U first;
+	INT64U ticks;
+	INT64U best = 0;
+
+	for(level = 0; level < RTOS_TMR_WHEEL_LEVELS; level++) {
+		if(shard->wheel.timer_count[level] == 0) {
+			continue;
+		}
+
+		// Slots of a Level are visited every span Ticks, starting from the first boundary at or after base
+		span = 1ULL << (level * RTOS_TMR_WHEEL_BITS);
+		first = (0 - base) & (span - 1);
+		start = ((base + first) >> (level * RTOS_TMR_WHEEL_BITS)) & RTOS_TMR_WHEEL_MASK;
+
+		// First Non Empty Slot in circular order from start
+		for(index = 0; index < RTOS_TMR_WHEEL_SIZE; index += 64 - ((start + index) & 63)) {
+			word = ((start + index) & RTOS_TMR_WHEEL_MASK) >> 6;
+			bits = shard->wheel.bitmap[level][word] >> ((start + index) & 63);
+
+			if(bits != 0) {
+				index += __builtin_ctzll(bits);
+				break;
+			}
+		}
+
+		if(index >= RTOS_TMR_WHEEL_SIZE) {
+			continue;
+		}
+
+		ticks = first + ((INT64U)index * span);
+
+		if((found == RTOS_FALSE) || (ticks < best)) {
+			best = ticks;
+			found = RTOS_TRUE;
+		}
+	}
+
+	// The Overflow List is looked at when the Top Level wraps
+	if(shard->wheel.overflow_count > 0) {
+		ticks = (0 - base) & (RTOS_TMR_WHEEL_SPAN - 1);
+
+		if((found == RTOS_FALSE) || (ticks < best)) {
+			best = ticks;
+			found = RTOS_TRUE;
+		}
+	}
+
+	*offset = best;
+	return found;
+}
+
+// Cascade the Levels and move the Timers of the current Tick to the end of the Expired List (Owner of the Shard only)
+void wheel_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail)
+{
+	INT8U level;
+	INT8U index;
+	RTOS_TMR *temp_timer = NULL;
+
+	index = shard->tick_ctr & RTOS_TMR_WHEEL_MASK;
+
+	// When a Level wraps, bring down the next Slot of the Level above it
+	level = 1;
+	while((index == 0) && (level < RTOS_TMR_WHEEL_LEVELS)) {
+		wheel_cascade(shard, level);
+		index = (shard->tick_ctr >> (level * RTOS_TMR_WHEEL_BITS)) & RTOS_TMR_WHEEL_MASK;
+		level++;
+	}
+
+	// When the Top Level wraps, bring the Overflow Timers now within reach into the Wheel
+	if((level == RTOS_TMR_WHEEL_LEVELS) && (index == 0)) {
+		wheel_refill_overflow(shard);
+	}
+
+	// Every Timer in the current Slot expires now
+	index = shard->tick_ctr & RTOS_TMR_WHEEL_MASK;
+
+	temp_timer = shard->wheel.slot[0][index];
+	shard->wheel.slot[0][index] = NULL;
+	shard->wheel.bitmap[0][index >> 6] &= ~(1ULL << (index & 63));
+
+	if(temp_timer == NULL) {
+		return;
+	}
+
+	// Append the Slot List after the Timers of the earlier Ticks, so they fire in Deadline order
+	if(*tail == NULL) {
+		shard->wheel.expired = temp_timer;
+	}
+	else {
+		(*tail)->RTOSTmrNext = temp_timer;
+		temp_timer->RTOSTmrPrev = *tail;
+	}
+
+	for(; temp_timer != NULL; temp_timer = temp_timer->RTOSTmrNext) {
+		temp_timer->RTOSTmrLevel = RTOS_TMR_WHEEL_EXPIRED;
+		shard->wheel.timer_count[0]--;
+		*tail = temp_timer;
+	}
+}
+
+// Fire every Timer of the Expired List, the Tick Counter is already at the end of the Pass (Owner of the Shard only)
+void wheel_fire_expired(TIMER_SHARD *shard)
+{
+	RTOS_TMR *temp_timer = NULL;
+	RTOS_TMR_COLD *cold;
+	RTOS_TMR_CALLBACK callback;
+	void *callback_arg;
+	INT64U fires;
+	INT64U missed;
+	INT8 *name;
+	INT32U gen;
+	INT8U overran;
+	INT8U state;
+#if RTOS_CFG_TMR_STATS
+	INT64U late;
+#endif
+
+	// Callbacks may Stop/Delete any Timer, so take one Entry at a time from the Expired List
+	while((temp_timer = shard->wheel.expired) != NULL) {
+		wheel_unlink(shard, temp_timer);
+
+		state = __atomic_load_n(&temp_timer->RTOSTmrState, __ATOMIC_SEQ_CST);
+
+		// Tombstone of a lazy Stop, or Stopped/Deleted by another Thread and its Message finishes the Job
+		if((state & RTOS_TMR_STATE_MASK) != RTOS_TMR_STATE_RUNNING) {
+			continue;
+		}
+
+		// Re-Started by another Thread, its Message links it again from the new Start Tick
+		if((state & RTOS_TMR_STATE_MSG) != 0) {
+			continue;
+		}
+
+		cold = timer_cold(temp_timer);
+		callback = cold->RTOSTmrCallback;
+		callback_arg = cold->RTOSTmrCallbackArg;
+		name = cold->RTOSTmrName;
+		fires = 1;
+
+#if RTOS_CFG_TMR_STATS
+		// Ticks between the Deadline before the Slack and the end of the Pass, in Powers of 2
+		late = shard->tick_ctr - (temp_timer->RTOSTmrMatch - cold->RTOSTmrLag);
+		late = (late == 0) ? 0 : (64 - __builtin_clzll(late));
+		late = (late < RTOS_TMR_STATS_HIST) ? late : (RTOS_TMR_STATS_HIST - 1);
+		__atomic_store_n(&shard->lateness[late], shard->lateness[late] + 1, __ATOMIC_RELAXED);
+#endif
+
+		// Check whether timer is periodic
+		if((cold->RTOSTmrOpt & RTOS_TMR_OPT_TYPE_MASK) == RTOS_TMR_PERIODIC) {
+			// Periods which also ended within this Pass, counted from the Deadline before the Slack
+			temp_timer->RTOSTmrMatch -= cold->RTOSTmrLag;
+			missed = (shard->tick_ctr - temp_timer->RTOSTmrMatch) / cold->RTOSTmrPeriod;
+
+			switch(cold->RTOSTmrMiss) {
+				case RTOS_TMR_MISS_FIRE_ONCE:
+					// Fire once and count the next Period from now
+					temp_timer->RTOSTmrMatch = shard->tick_ctr + cold->RTOSTmrPeriod;
+					break;
+
+				case RTOS_TMR_MISS_SKIP:
+					// Fire once and drop the missed Periods, staying on the original Grid
+					temp_timer->RTOSTmrMatch += (missed + 1) * cold->RTOSTmrPeriod;
+					break;
+
+				default:
+					// Fire once for every Period which ended
+					fires += missed;
+					temp_timer->RTOSTmrMatch += (missed + 1) * cold->RTOSTmrPeriod;
+					break;
+			}
+
+			// Again Add the Timer in the Timer Queue
+			timer_slack_align(temp_timer, cold);
+			timer_queue->link(shard, temp_timer);
+		}
+		else if(timer_state_swap(temp_timer, RTOS_TMR_STATE_RUNNING, RTOS_TMR_STATE_COMPLETED, NULL) == RTOS_FALSE) {
+			// Lost to a Stop/Delete from another Shard
+			continue;
+		}
+
+		if(callback == NULL) {
+			continue;
+		}
+
+#if RTOS_CFG_TMR_STATS
+		__atomic_store_n(&shard->fired, shard->fired + fires, __ATOMIC_RELAXED);
+#endif
+
+		// Hand the Callbacks to the Executor, unless they are kept Inline or the Executor Queue is full
+		if((RTOSTmrCfg.RTOSTmrExecThreads > 0) && ((cold->RTOSTmrOpt & RTOS_TMR_FLAG_INLINE) == 0)) {
+			while((fires > 0) && (exec_queue_push(callback, callback_arg, name) == RTOS_TRUE)) {
+				fires--;
+			}
+		}
+
+		if(fires == 0) {
+			continue;
+		}
+
+		gen = cold->RTOSTmrGen;
+		overran = RTOS_FALSE;
+
+		// The Callback may Start/Stop/Delete Timers of this Shard right away, as it runs in the Owner
+		while(fires-- > 0) {
+			overran |= timer_callback_run(callback, callback_arg, name);
+		}
+
+		// Callback ran over the Budget of the Watchdog, count it against the Timer unless it Deleted it
+		if((overran == RTOS_TRUE) && (__atomic_load_n(&cold->RTOSTmrGen, __ATOMIC_ACQUIRE) == gen)) {
+			timer_watchdog_overrun(temp_timer, cold);
+		}
+	}
+}
+
+// Process every Tick of the Timing Wheel up to the target Tick in one Pass (Owner of the Shard only)
+void wheel_advance(TIMER_SHARD *shard, INT64U target_tick)
+{
+	INT64U offset;
+	INT32U busy = 0;
+#if RTOS_CFG_TMR_STATS
+	INT64U start_ns = 0;
+	INT64U busy_ns;
+#endif
+	RTOS_TMR *tail = NULL;
+
+	// Collect the Timers of every busy Tick in (Tick Counter, target Tick], skipping the empty Ticks
+	while(target_tick > shard->tick_ctr) {
+		if((timer_queue->next_event(shard, &offset) == RTOS_FALSE) || (offset >= (target_tick - shard->tick_ctr))) {
+			// Nothing expires or cascades up to the target Tick, jump straight to it
+			shard->tick_ctr = target_tick;
+			break;
+		}
+
+		shard->tick_ctr += offset + 1;
+
+#if RTOS_CFG_TMR_STATS
+		if(busy == 0) {
+			start_ns = get_monotonic_ns();
+		}
+#endif
+		busy++;
+		timer_queue->collect_tick(shard, &tail);
+	}
+
+	if(busy == 0) {
+		return;
+	}
+
+	// Then fire them all at once, each Deadline exactly once
+	wheel_fire_expired(shard);
+
+#if RTOS_CFG_TMR_STATS
+	busy_ns = get_monotonic_ns() - start_ns;
+
+	// Time spent on busy Ticks, Inline Callbacks included, read by RTOSTmrStatsGet() without a Lock
+	__atomic_store_n(&shard->tick_busy_ns, shard->tick_busy_ns + busy_ns, __ATOMIC_RELAXED);
+	__atomic_store_n(&shard->tick_busy_count, shard->tick_busy_count + busy, __ATOMIC_RELAXED);
+
+	if(busy_ns > shard->tick_busy_max_ns) {
+		__atomic_store_n(&shard->tick_busy_max_ns, busy_ns, __ATOMIC_RELAXED);
+	}
+#endif
+}
+
+// Insert a Timer Object in the Timer Queue of its Shard (Owner of the Shard only)
+void insert_wheel_entry(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	// The Tick may have moved past the Match while computing it, then expire on the next Tick
+	if(timer_obj->RTOSTmrMatch <= shard->tick_ctr) {
+		timer_obj->RTOSTmrMatch = shard->tick_ctr + 1;
+	}
+
+	timer_queue->link(shard, timer_obj);
+}
+
+// Remove the Timer Object entry from the Timer Queue of its Shard (Owner of the Shard only)
+void remove_wheel_entry(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	timer_queue_unlink(shard, timer_obj);
+}
+
+// Unlink a Timer from the Timer Queue of its Shard or from the Expired List (Owner of the Shard only)
+void timer_queue_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	if(timer_obj->RTOSTmrLevel == RTOS_TMR_WHEEL_QUEUED) {
+		timer_queue->unlink(shard, timer_obj);
+	}
+	else {
+		// Wheel Slots, Overflow and Expired List are all Wheel Lists
+		wheel_unlink(shard, timer_obj);
+	}
+}
+
+// Append a Timer taken out of the Queue to the Expired List (Owner of the Shard only)
+void timer_expired_append(TIMER_SHARD *shard, RTOS_TMR *timer_obj, RTOS_TMR **tail)
+{
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_EXPIRED;
+	timer_obj->RTOSTmrNext = NULL;
+	timer_obj->RTOSTmrPrev = *tail;
+
+	if(*tail == NULL) {
+		shard->wheel.expired = timer_obj;
+	}
+	else {
+		(*tail)->RTOSTmrNext = timer_obj;
+	}
+	*tail = timer_obj;
+}
+
+// Buckets of the first Hash Table of a Shard, about one per Timer but no more than Ticks in the usual Delay Range
+INT32U hash_size(void)
+{
+	INT64U buckets = RTOSTmrCfg.RTOSTmrHashBuckets;
+	INT64U range;
+
+	if(buckets != 0) {
+		return (INT32U)buckets;
+	}
+
+	// Timers each Shard is expected to hold
+	buckets = (TmrPoolSize + RTOS_TMR_SHARDS - 1) / RTOS_TMR_SHARDS;
+
+	// With the Range in Ticks no larger, every Timer of a Bucket is in the same Lap
+	if(RTOSTmrCfg.RTOSTmrDelayRangeNs != 0) {
+		range = RTOSTmrCfg.RTOSTmrDelayRangeNs / RTOS_TMR_TICK_NS + 1;
+
+		if(range < buckets) {
+			buckets = range;
+		}
+	}
+
+	if(buckets < RTOS_TMR_HASH_MIN) {
+		return RTOS_TMR_HASH_MIN;
+	}
+
+	if(buckets >= RTOS_TMR_HASH_MAX) {
+		return RTOS_TMR_HASH_MAX;
+	}
+
+	// Round up to a Power of 2
+	return 1U << (64 - __builtin_clzll(buckets - 1));
+}
+
+// Lay the empty Buckets, Tails and Bitmap of a Hash Table out in one Block
+void hash_table_carve(TIMER_HASH_TABLE *table, void *block, INT32U buckets)
+{
+	memset(block, 0, (sizeof(RTOS_TMR*) * 2 * buckets) + (sizeof(INT64U) * (buckets / 64)));
+
+	table->bucket = (RTOS_TMR**)block;
+	table->tail = table->bucket + buckets;
+	table->bitmap = (INT64U*)(table->tail + buckets);
+	table->mask = buckets - 1;
+}
+
+#if !RTOS_CFG_STATIC
+// Allocate the empty Buckets, Tails and Bitmap of a Hash Table in one Block
+INT8U hash_table_alloc(TIMER_HASH_TABLE *table, INT32U buckets)
+{
+	void *block;
+
+	if(posix_memalign(&block, RTOS_TMR_CACHE_LINE, (sizeof(RTOS_TMR*) * 2 * buckets) + (sizeof(INT64U) * (buckets / 64))) != 0) {
+		return RTOS_MALLOC_ERR;
+	}
+
+	hash_table_carve(table, block, buckets);
+	return RTOS_SUCCESS;
+}
+#endif
+
+// Link the Timer Object in the Bucket of its Match, in Match order
+void hash_table_insert(TIMER_HASH_TABLE *table, RTOS_TMR *timer_obj)
+{
+	INT32U index = timer_obj->RTOSTmrMatch & table->mask;
+	RTOS_TMR *prev_timer = table->tail[index];
+
+	// Deadlines mostly grow, so the Entry usually goes right at the Tail; equal Matches keep their Start order
+	while((prev_timer != NULL) && (prev_timer->RTOSTmrMatch > timer_obj->RTOSTmrMatch)) {
+		prev_timer = prev_timer->RTOSTmrPrev;
+	}
+
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_QUEUED;
+	timer_obj->RTOSTmrPrev = prev_timer;
+
+	if(prev_timer == NULL) {
+		timer_obj->RTOSTmrNext = table->bucket[index];
+		table->bucket[index] = timer_obj;
+	}
+	else {
+		timer_obj->RTOSTmrNext = prev_timer->RTOSTmrNext;
+		prev_timer->RTOSTmrNext = timer_obj;
+	}
+
+	if(timer_obj->RTOSTmrNext == NULL) {
+		table->tail[index] = timer_obj;
+	}
+	else {
+		timer_obj->RTOSTmrNext->RTOSTmrPrev = timer_obj;
+	}
+
+	table->bitmap[index >> 6] |= (1ULL << (index & 63));
+}
+
+// Unlink the Timer Object from its Bucket
+void hash_table_remove(TIMER_HASH_TABLE *table, RTOS_TMR *timer_obj)
+{
+	INT32U index = timer_obj->RTOSTmrMatch & table->mask;
+
+	if(timer_obj->RTOSTmrPrev == NULL) {
+		table->bucket[index] = timer_obj->RTOSTmrNext;
+	}
+	else {
+		timer_obj->RTOSTmrPrev->RTOSTmrNext = timer_obj->RTOSTmrNext;
+	}
+
+	if(timer_obj->RTOSTmrNext == NULL) {
+		table->tail[index] = timer_obj->RTOSTmrPrev;
+	}
+	else {
+		timer_obj->RTOSTmrNext->RTOSTmrPrev = timer_obj->RTOSTmrPrev;
+	}
+
+	if(table->bucket[index] == NULL) {
+		table->bitmap[index >> 6] &= ~(1ULL << (index & 63));
+	}
+
+	timer_obj->RTOSTmrNext = NULL;
+	timer_obj->RTOSTmrPrev = NULL;
+}
+
+// Get the Table holding a Match, the old one while its Bucket has not been moved yet
+TIMER_HASH_TABLE* hash_table_of(TIMER_SHARD *shard, INT64U match)
+{
+	if((shard->wheel.hash_old.bucket != NULL) && ((match & shard->wheel.hash_old.mask) >= shard->wheel.hash_rehash)) {
+		return &shard->wheel.hash_old;
+	}
+	return &shard->wheel.hash;
+}
+
+// Allocate the first Hash Table of a Shard
+INT8U hash_init(TIMER_SHARD *shard)
+{
+#if RTOS_CFG_STATIC && (RTOS_CFG_STATIC_QUEUE == RTOS_TMR_QUEUE_HASH)
+	hash_table_carve(&shard->wheel.hash, TmrStaticHash[shard - TmrStaticShards], RTOS_CFG_STATIC_HASH_BUCKETS);
+	return RTOS_SUCCESS;
+#elif RTOS_CFG_STATIC
+	// No static Storage for a Queue other than the configured one
+	(void)shard;
+	return RTOS_MALLOC_ERR;
+#else
+	return hash_table_alloc(&shard->wheel.hash, hash_size());
+#endif
+}
+
+// Free the Hash Tables of a Shard
+void hash_free(TIMER_SHARD *shard)
+{
+#if !RTOS_CFG_STATIC
+	free(shard->wheel.hash.bucket);
+	free(shard->wheel.hash_old.bucket);
+#endif
+	memset(&shard->wheel.hash, 0, sizeof(shard->wheel.hash));
+	memset(&shard->wheel.hash_old, 0, sizeof(shard->wheel.hash_old));
+}
+
+// Double the Hash Table, its Buckets are moved over a few at a time by hash_rehash_step() (Owner of the Shard only)
+void hash_grow(TIMER_SHARD *shard)
+{
+#if RTOS_CFG_STATIC
+	// The static Table keeps its Size
+	(void)shard;
+#else
+	TIMER_HASH_TABLE table;
+
+	// Without Memory the Table stays as it is and only its Buckets get longer
+	if(hash_table_alloc(&table, (shard->wheel.hash.mask + 1) * 2) != RTOS_SUCCESS) {
+		return;
+	}
+
+	shard->wheel.hash_old = shard->wheel.hash;
+	shard->wheel.hash = table;
+	shard->wheel.hash_rehash = 0;
+#endif
+}
+
+// Move Buckets of the old Hash Table into the new one, freeing the old Table after its last Bucket (Owner of the Shard only)
+void hash_rehash_step(TIMER_SHARD *shard, INT32U buckets)
+{
+	TIMER_HASH_TABLE *old_table = &shard->wheel.hash_old;
+	RTOS_TMR *temp_timer;
+	RTOS_TMR *next_timer;
+
+	while((buckets-- > 0) && (shard->wheel.hash_rehash <= old_table->mask)) {
+		temp_timer = old_table->bucket[shard->wheel.hash_rehash];
+
+		// The Bucket splits in two new Buckets which are still empty, so each Timer is appended at the Tail in order
+		while(temp_timer != NULL) {
+			next_timer = temp_timer->RTOSTmrNext;
+			hash_table_insert(&shard->wheel.hash, temp_timer);
+			temp_timer = next_timer;
+		}
+
+		shard->wheel.hash_rehash++;
+	}
+
+	if(shard->wheel.hash_rehash > old_table->mask) {
+#if !RTOS_CFG_STATIC
+		free(old_table->bucket);
+#endif
+		memset(old_table, 0, sizeof(*old_table));
+	}
+}
+
+// Link the Timer Object in the Hash Table of its Shard, growing the Table past RTOS_TMR_HASH_LOAD Timers per Bucket (Owner of the Shard only)
+void hash_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+#if !RTOS_CFG_STATIC
+	if(shard->wheel.hash_old.bucket != NULL) {
+		hash_rehash_step(shard, RTOS_TMR_HASH_REHASH_STEP);
+	}
+	else if((shard->wheel.queue_count >= ((INT64U)shard->wheel.hash.mask + 1) * RTOS_TMR_HASH_LOAD)
+		&& (shard->wheel.hash.mask + 1 < RTOS_TMR_HASH_MAX)) {
+		hash_grow(shard);
+	}
+#endif
+
+	hash_table_insert(hash_table_of(shard, timer_obj->RTOSTmrMatch), timer_obj);
+	shard->wheel.queue_count++;
+}
+
+// Unlink the Timer Object from the Hash Table of its Shard (Owner of the Shard only)
+void hash_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	hash_table_remove(hash_table_of(shard, timer_obj->RTOSTmrMatch), timer_obj);
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+	shard->wheel.queue_count--;
+}
+
+// Find the Ticks after the next Tick until a Non Empty Bucket comes around, its Timers may be Laps ahead (Owner of the Shard only)
+INT8U hash_next_event(TIMER_SHARD *shard, INT64U *offset)
+{
+	TIMER_HASH_TABLE *table = &shard->wheel.hash;
+	INT32U start = (shard->tick_ctr + 1) & table->mask;
+	INT32U index;
+	INT32U bucket;
+	INT64U bits;
+
+	if(shard->wheel.queue_count == 0) {
+		return RTOS_FALSE;
+	}
+
+	// While the Table grows every Tick is visited, each moves some Buckets
+	if(shard->wheel.hash_old.bucket != NULL) {
+		*offset = 0;
+		return RTOS_TRUE;
+	}
+
+	// First Non Empty Bucket in circular order from start
+	for(index = 0; index <= table->mask; index += 64 - (bucket & 63)) {
+		bucket = (start + index) & table->mask;
+		bits = table->bitmap[bucket >> 6] >> (bucket & 63);
+
+		if(bits != 0) {
+			*offset = index + __builtin_ctzll(bits);
+			return RTOS_TRUE;
+		}
+	}
+	return RTOS_FALSE;
+}
+
+// Splice the due Prefix of the Bucket of the current Tick onto the Expired List (Owner of the Shard only)
+void hash_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail)
+{
+	TIMER_HASH_TABLE *table;
+	INT32U index;
+	RTOS_TMR *first_timer;
+	RTOS_TMR *last_timer = NULL;
+	RTOS_TMR *temp_timer;
+
+	if(shard->wheel.hash_old.bucket != NULL) {
+		hash_rehash_step(shard, RTOS_TMR_HASH_REHASH_STEP);
+	}
+
+	table = hash_table_of(shard, shard->tick_ctr);
+	index = shard->tick_ctr & table->mask;
+	first_timer = table->bucket[index];
+
+	// The Bucket is sorted, so the Scan stops at the first Entry of a later Lap
+	for(temp_timer = first_timer; (temp_timer != NULL) && (temp_timer->RTOSTmrMatch <= shard->tick_ctr); temp_timer = temp_timer->RTOSTmrNext) {
+		temp_timer->RTOSTmrLevel = RTOS_TMR_WHEEL_EXPIRED;
+		last_timer = temp_timer;
+		shard->wheel.queue_count--;
+	}
+
+	if(last_timer == NULL) {
+		return;
+	}
+
+	// Detach the Prefix from the Bucket
+	table->bucket[index] = temp_timer;
+
+	if(temp_timer == NULL) {
+		table->tail[index] = NULL;
+		table->bitmap[index >> 6] &= ~(1ULL << (index & 63));
+	}
+	else {
+		temp_timer->RTOSTmrPrev = NULL;
+	}
+
+	// And append it to the Expired List in one Piece
+	last_timer->RTOSTmrNext = NULL;
+	first_timer->RTOSTmrPrev = *tail;
+
+	if(*tail == NULL) {
+		shard->wheel.expired = first_timer;
+	}
+	else {
+		(*tail)->RTOSTmrNext = first_timer;
+	}
+	*tail = last_timer;
+}
+
+// Allocate the Heap Array of a Shard, &heap[1] is Cache Line aligned so the 4 Children of an Entry share a Line
+INT8U heap_init(TIMER_SHARD *shard)
+{
+#if RTOS_CFG_STATIC && (RTOS_CFG_STATIC_QUEUE == RTOS_TMR_QUEUE_HEAP)
+	shard->wheel.heap_base = TmrStaticHeap[shard - TmrStaticShards];
+	shard->wheel.heap = (TIMER_HEAP_ENTRY*)shard->wheel.heap_base + (RTOS_TMR_CACHE_LINE / sizeof(TIMER_HEAP_ENTRY)) - 1;
+	shard->wheel.heap_size = RTOS_CFG_STATIC_POOL;
+	return RTOS_SUCCESS;
+#elif RTOS_CFG_STATIC
+	// No static Storage for a Queue other than the configured one
+	(void)shard;
+	return RTOS_MALLOC_ERR;
+#else
+	INT32U pad = (RTOS_TMR_CACHE_LINE / sizeof(TIMER_HEAP_ENTRY)) - 1;
+	INT32U size = __atomic_load_n(&TmrPoolSize, __ATOMIC_ACQUIRE);
+
+	// Like the static Heap it holds the whole Pool, so linking a Timer never allocates
+	if(size < RTOS_TMR_HEAP_INIT) {
+		size = RTOS_TMR_HEAP_INIT;
+	}
+
+	if(posix_memalign(&shard->wheel.heap_base, RTOS_TMR_CACHE_LINE, sizeof(TIMER_HEAP_ENTRY) * ((INT64U)size + pad)) != 0) {
+		shard->wheel.heap_base = NULL;
+		return RTOS_MALLOC_ERR;
+	}
+
+	shard->wheel.heap = (TIMER_HEAP_ENTRY*)shard->wheel.heap_base + pad;
+	shard->wheel.heap_size = size;
+	return RTOS_SUCCESS;
+#endif
+}
+
+// Reserve a Heap Array for timer_count Timers on every Shard whose Heap is smaller, its first Pad Entry holds the Size.
+// Called by grow_timer_pool() under timer_pool_mutex, the Owner of the Shard swaps it in when its Heap is full
+INT8U heap_reserve(INT32U timer_count)
+{
+	INT32U i;
+	INT32U pad = (RTOS_TMR_CACHE_LINE / sizeof(TIMER_HEAP_ENTRY)) - 1;
+	void *base;
+	TIMER_SHARD *shards = __atomic_load_n(&timer_shards, __ATOMIC_ACQUIRE);
+
+	// heap_init() sizes the Heaps of Shards created later
+	if((shards == NULL) || (RTOSTmrCfg.RTOSTmrQueue != RTOS_TMR_QUEUE_HEAP)) {
+		return RTOS_SUCCESS;
+	}
+
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		if(timer_count <= __atomic_load_n(&shards[i].wheel.heap_size, __ATOMIC_RELAXED)) {
+			continue;
+		}
+
+		if(posix_memalign(&base, RTOS_TMR_CACHE_LINE, sizeof(TIMER_HEAP_ENTRY) * ((INT64U)timer_count + pad)) != 0) {
+			return RTOS_MALLOC_ERR;
+		}
+		((TIMER_HEAP_ENTRY*)base)->match = timer_count;
+
+		// A smaller Array reserved before and not taken yet is no longer needed
+		free(__atomic_exchange_n(&shards[i].wheel.heap_spare, base, __ATOMIC_ACQ_REL));
+	}
+	return RTOS_SUCCESS;
+}
+
+// Free the Heap Array of a Shard
+void heap_free(TIMER_SHARD *shard)
+{
+#if !RTOS_CFG_STATIC
+	free(shard->wheel.heap_base);
+	free(shard->wheel.heap_spare);
+	shard->wheel.heap_spare = NULL;
+#endif
+	shard->wheel.heap_base = NULL;
+	shard->wheel.heap = NULL;
+	shard->wheel.heap_size = 0;
+}
+
+// Store a Heap Entry at a Position and point its Timer back at it
+void heap_place(TIMER_SHARD *shard, INT32U pos, TIMER_HEAP_ENTRY entry)
+{
+	shard->wheel.heap[pos] = entry;
+	timer_node(entry.timer)->RTOSTmrHeapPos = pos;
+}
+
+// Move an Entry for the free Position pos up towards the Root until its Parent is due earlier
+void heap_sift_up(TIMER_SHARD *shard, INT32U pos, TIMER_HEAP_ENTRY entry)
+{
+	INT32U parent;
+
+	while(pos > 0) {
+		parent = (pos - 1) >> 2;
+
+		if(shard->wheel.heap[parent].match <= entry.match) {
+			break;
+		}
+
+		heap_place(shard, pos, shard->wheel.heap[parent]);
+		pos = parent;
+	}
+
+	heap_place(shard, pos, entry);
+}
+
+// Move an Entry for the free Position pos down until none of its Children is due earlier
+void heap_sift_down(TIMER_SHARD *shard, INT32U pos, TIMER_HEAP_ENTRY entry)
+{
+	INT32U child;
+	INT32U last;
+	INT32U best;
+	INT32U count = shard->wheel.queue_count;
+
+	while((child = (pos << 2) + 1) < count) {
+		// Earliest of the up to 4 Children
+		last = (child + 4 < count) ? (child + 4) : count;
+		best = child;
+
+		for(child++; child < last; child++) {
+			if(shard->wheel.heap[child].match < shard->wheel.heap[best].match) {
+				best = child;
+			}
+		}
+
+		if(shard->wheel.heap[best].match >= entry.match) {
+			break;
+		}
+
+		heap_place(shard, pos, shard->wheel.heap[best]);
+		pos = best;
+	}
+
+	heap_place(shard, pos, entry);
+}
+
+// Add the Timer Object to the Heap by its Match (Owner of the Shard only)
+void heap_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	TIMER_HEAP_ENTRY entry;
+#if !RTOS_CFG_STATIC
+	INT32U pad = (RTOS_TMR_CACHE_LINE / sizeof(TIMER_HEAP_ENTRY)) - 1;
+	void *base;
+
+	// Full only after the Pool grew, and grow_timer_pool() then reserved an Array for the whole Pool.
+	// The static Heap holds the whole Pool and is never full
+	if(shard->wheel.queue_count == shard->wheel.heap_size) {
+		base = __atomic_exchange_n(&shard->wheel.heap_spare, NULL, __ATOMIC_ACQ_REL);
+
+		memcpy((TIMER_HEAP_ENTRY*)base + pad, shard->wheel.heap, sizeof(TIMER_HEAP_ENTRY) * shard->wheel.queue_count);
+		free(shard->wheel.heap_base);
+
+		shard->wheel.heap_base = base;
+		shard->wheel.heap = (TIMER_HEAP_ENTRY*)base + pad;
+		__atomic_store_n(&shard->wheel.heap_size, (INT32U)((TIMER_HEAP_ENTRY*)base)->match, __ATOMIC_RELAXED);
+	}
+#endif
+
+	entry.match = timer_obj->RTOSTmrMatch;
+	entry.timer = timer_obj;
+
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_QUEUED;
+	heap_sift_up(shard, shard->wheel.queue_count++, entry);
+}
+
+// Remove the Timer Object from the Heap through its Position, the last Entry fills the Hole (Owner of the Shard only)
+void heap_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	INT32U pos = timer_node(timer_obj)->RTOSTmrHeapPos;
+	TIMER_HEAP_ENTRY last;
+
+	last = shard->wheel.heap[--shard->wheel.queue_count];
+
+	if(pos < shard->wheel.queue_count) {
+		if((pos > 0) && (last.match < shard->wheel.heap[(pos - 1) >> 2].match)) {
+			heap_sift_up(shard, pos, last);
+		}
+		else {
+			heap_sift_down(shard, pos, last);
+		}
+	}
+
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+}
+
+// Ticks after the next Tick until the Root is due (Owner of the Shard only)
+INT8U heap_next_event(TIMER_SHARD *shard, INT64U *offset)
+{
+	if(shard->wheel.queue_count == 0) {
+		return RTOS_FALSE;
+	}
+
+	// A Match within the current Tick is due on the next one
+	*offset = (shard->wheel.heap[0].match > shard->tick_ctr) ? (shard->wheel.heap[0].match - (shard->tick_ctr + 1)) : 0;
+	return RTOS_TRUE;
+}
+
+// Pop every Timer whose Match is reached to the Expired List, in Deadline order (Owner of the Shard only)
+void heap_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail)
+{
+	RTOS_TMR *temp_timer;
+
+	while((shard->wheel.queue_count > 0) && (shard->wheel.heap[0].match <= shard->tick_ctr)) {
+		temp_timer = shard->wheel.heap[0].timer;
+		heap_unlink(shard, temp_timer);
+		timer_expired_append(shard, temp_timer, tail);
+	}
+}
+
+// Meld two Pairing Heaps, the later Root becomes the first Child of the earlier one
+RTOS_TMR* pairing_meld(RTOS_TMR *first, RTOS_TMR *second)
+{
+	RTOS_TMR *temp_timer;
+	RTOS_TMR_NODE *node;
+
+	if(second->RTOSTmrMatch < first->RTOSTmrMatch) {
+		temp_timer = first;
+		first = second;
+		second = temp_timer;
+	}
+
+	// A first Child points back at its Parent, the others at their left Sibling
+	node = timer_node(first);
+	second->RTOSTmrNext = node->RTOSTmrChild;
+	second->RTOSTmrPrev = first;
+
+	if(node->RTOSTmrChild != NULL) {
+		node->RTOSTmrChild->RTOSTmrPrev = second;
+	}
+	node->RTOSTmrChild = second;
+
+	return first;
+}
+
+// Meld a List of Sibling Heaps into one, in Pairs from the left and then the Pairs from the right
+RTOS_TMR* pairing_merge_pairs(RTOS_TMR *first)
+{
+	RTOS_TMR *pair;
+	RTOS_TMR *second;
+	RTOS_TMR *next_timer;
+	RTOS_TMR *pairs = NULL;
+	RTOS_TMR *root = NULL;
+
+	// First Pass, the melded Pairs are stacked through RTOSTmrNext
+	while(first != NULL) {
+		second = first->RTOSTmrNext;
+		next_timer = (second == NULL) ? NULL : second->RTOSTmrNext;
+
+		first->RTOSTmrPrev = NULL;
+		pair = first;
+
+		if(second != NULL) {
+			second->RTOSTmrPrev = NULL;
+			pair = pairing_meld(first, second);
+		}
+
+		pair->RTOSTmrNext = pairs;
+		pairs = pair;
+		first = next_timer;
+	}
+
+	// Second Pass, meld the Pairs into the Root from the rightmost one
+	while(pairs != NULL) {
+		next_timer = pairs->RTOSTmrNext;
+		pairs->RTOSTmrNext = NULL;
+
+		root = (root == NULL) ? pairs : pairing_meld(root, pairs);
+		pairs = next_timer;
+	}
+	return root;
+}
+
+// Meld the Timer Object into the Pairing Heap in O(1) (Owner of the Shard only)
+void pairing_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	timer_node(timer_obj)->RTOSTmrChild = NULL;
+	timer_obj->RTOSTmrNext = NULL;
+	timer_obj->RTOSTmrPrev = NULL;
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_QUEUED;
+
+	shard->wheel.pairing = (shard->wheel.pairing == NULL) ? timer_obj : pairing_meld(shard->wheel.pairing, timer_obj);
+	shard->wheel.queue_count++;
+}
+
+// Cut the Timer Object out of the Pairing Heap and meld its Children back (Owner of the Shard only)
+void pairing_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj)
+{
+	RTOS_TMR *children = pairing_merge_pairs(timer_node(timer_obj)->RTOSTmrChild);
+
+	if(timer_obj == shard->wheel.pairing) {
+		shard->wheel.pairing = children;
+	}
+	else {
+		// Take it out of the Sibling List, its back Pointer is its Parent when it is the first Child
+		if(timer_node(timer_obj->RTOSTmrPrev)->RTOSTmrChild == timer_obj) {
+			timer_node(timer_obj->RTOSTmrPrev)->RTOSTmrChild = timer_obj->RTOSTmrNext;
+		}
+		else {
+			timer_obj->RTOSTmrPrev->RTOSTmrNext = timer_obj->RTOSTmrNext;
+		}
+
+		if(timer_obj->RTOSTmrNext != NULL) {
+			timer_obj->RTOSTmrNext->RTOSTmrPrev = timer_obj->RTOSTmrPrev;
+		}
+
+		if(children != NULL) {
+			shard->wheel.pairing = pairing_meld(shard->wheel.pairing, children);
+		}
+	}
+
+	timer_node(timer_obj)->RTOSTmrChild = NULL;
+	timer_obj->RTOSTmrNext = NULL;
+	timer_obj->RTOSTmrPrev = NULL;
+	timer_obj->RTOSTmrLevel = RTOS_TMR_WHEEL_NONE;
+	shard->wheel.queue_count--;
+}
+
+// Ticks after the next Tick until the Root is due (Owner of the Shard only)
+INT8U pairing_next_event(TIMER_SHARD *shard, INT64U *offset)
+{
+	if(shard->wheel.pairing == NULL) {
+		return RTOS_FALSE;
+	}
+
+	// A Match within the current Tick is due on the next one
+	*offset = (shard->wheel.pairing->RTOSTmrMatch > shard->tick_ctr) ? (shard->wheel.pairing->RTOSTmrMatch - (shard->tick_ctr + 1)) : 0;
+	return RTOS_TRUE;
+}
+
+// Pop every Timer whose Match is reached to the Expired List, in Deadline order (Owner of the Shard only)
+void pairing_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail)
+{
+	RTOS_TMR *temp_timer;
+
+	while((shard->wheel.pairing != NULL) && (shard->wheel.pairing->RTOSTmrMatch <= shard->tick_ctr)) {
+		temp_timer = shard->wheel.pairing;
+		pairing_unlink(shard, temp_timer);
+		timer_expired_append(shard, temp_timer, tail);
+	}
+}
+
+// Round the Match up to the Slack Granularity of the Timer, so Timers with nearby Deadlines expire on the same Tick
+void timer_slack_align(RTOS_TMR *ptmr, RTOS_TMR_COLD *cold)
+{
+	INT64U mask = (1ULL << cold->RTOSTmrSlackShift) - 1;
+	INT64U match = (ptmr->RTOSTmrMatch + mask) & ~mask;
+
+	cold->RTOSTmrLag = (INT32U)(match - ptmr->RTOSTmrMatch);
+	ptmr->RTOSTmrMatch = match;
+}
+
+// First Match of a Timer Started at the given Tick, before the Slack
+INT64U timer_first_match(RTOS_TMR_COLD *cold, INT64U tick)
+{
+	if(((cold->RTOSTmrOpt & RTOS_TMR_OPT_TYPE_MASK) == RTOS_TMR_PERIODIC) && (cold->RTOSTmrDelay <= 0)) {
+		// For Periodic Timer without Delay, Fill up the Time = Period
+		return tick + cold->RTOSTmrPeriod;
+	}
+
+	// For One Shot Timer, and Periodic Timer with Delay, Fill up the Time = Delay
+	return tick + cold->RTOSTmrDelay;
+}
+
+// Tick of the last posted Start of a Timer, never past the given later Tick of the Shard
+INT64U timer_start_tick(RTOS_TMR_COLD *cold, INT64U tick)
+{
+	INT64U start = __atomic_load_n(&cold->RTOSTmrStartTick, __ATOMIC_RELAXED);
+
+	return (start > tick) ? tick : start;
+}
+
+// Link a Running Timer in the Wheel of its Shard from the given Tick (Owner of the Shard only)
+void timer_arm(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT64U tick)
+{
+	RTOS_TMR_COLD *cold = timer_cold(ptmr);
+
+	remove_wheel_entry(shard, ptmr);
+
+	// A Message still in the Mailbox then arms the Timer from the same Tick
+	__atomic_store_n(&cold->RTOSTmrStartTick, tick, __ATOMIC_RELAXED);
+
+	ptmr->RTOSTmrMatch = timer_first_match(cold, tick);
+	timer_slack_align(ptmr, cold);
+
+	insert_wheel_entry(shard, ptmr);
+}
+
+// Move a Stopped/Completed Timer to Running, RTOS_TRUE when the Caller has to arm it (plink as timer_state_swap())
+INT8U timer_start_claim(RTOS_TMR *ptmr, INT8U *perr, INT8U *plink)
+{
+	INT8U state;
+
+	state = timer_state(ptmr);
+	*perr = RTOS_SUCCESS;
+
+	if(state == RTOS_TMR_STATE_RUNNING) {
+		// No need to make any changes as it is already active
+		return RTOS_FALSE;
+	}
+
+	if(state == RTOS_TMR_STATE_UNUSED) {
+		*perr = RTOS_ERR_TMR_INACTIVE;
+		return RTOS_FALSE;
+	}
+
+	// Lost to a concurrent Start/Stop/Delete
+	if(((state != RTOS_TMR_STATE_STOPPED) && (state != RTOS_TMR_STATE_COMPLETED))
+		|| (timer_state_swap(ptmr, state, RTOS_TMR_STATE_RUNNING, plink) == RTOS_FALSE)) {
+		*perr = RTOS_ERR_TMR_INVALID_STATE;
+		return RTOS_FALSE;
+	}
+	return RTOS_TRUE;
+}
+
+// Start a Timer in the Wheel of its Shard from the given Tick (Owner of the Shard only), returns the Error Code
+INT8U start_timer_owner(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT64U tick)
+{
+	INT8U err;
+
+	if(timer_start_claim(ptmr, &err, NULL) == RTOS_TRUE) {
+		timer_arm(shard, ptmr, tick);
+	}
+	return err;
+}
+
+// Stop a Timer of the Shard (Owner of the Shard only), returns the Error Code
+INT8U stop_timer_owner(TIMER_SHARD *shard, RTOS_TMR *ptmr)
+{
+	INT8U err;
+
+	// Change the State to Stopped
+	if(timer_state_claim(ptmr, RTOS_TMR_STATE_STOPPED, &err, NULL) == RTOS_FALSE) {
+		return err;
+	}
+
+	// Remove the Timer from the Timing Wheel
+	remove_wheel_entry(shard, ptmr);
+	return RTOS_SUCCESS;
+}
+
+// Delete a Timer of the Shard (Owner of the Shard only), returns the Error Code
+INT8U del_timer_owner(TIMER_SHARD *shard, RTOS_TMR *ptmr)
+{
+	INT8U err;
+
+	if(timer_state_claim(ptmr, RTOS_TMR_STATE_UNUSED, &err, NULL) == RTOS_FALSE) {
+		return err;
+	}
+
+	// Remove the Timer from the Timing Wheel
+	remove_wheel_entry(shard, ptmr);
+
+	// Free the Timer Object, unless a Message still refers to it (no Message is posted once it is Unused)
+	if((__atomic_load_n(&ptmr->RTOSTmrState, __ATOMIC_SEQ_CST) & RTOS_TMR_STATE_MSG) == 0) {
+		free_timer_obj(ptmr);
+	}
+	return RTOS_SUCCESS;
+}
+
+// Start (tick is the Start Tick), Stop or Delete a Timer (op is RTOS_TMR_BATCH_START/STOP/DEL), returns the Error Code.
+// The Owner of the Shard changes the Wheel right away, any other Thread changes the State and posts the Timer to the
+// Mailbox of the Shard, so the Wheel has a single Writer
+INT8U timer_command(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT8U op, INT64U tick)
+{
+	RTOS_TMR_COLD *cold = timer_cold(ptmr);
+	INT8U state;
+	INT8U link = RTOS_FALSE;
+	INT8U err;
+	INT64U match = RTOS_TMR_NO_DEADLINE;
+
+	if(timer_is_owner(shard) == RTOS_TRUE) {
+		switch(op) {
+			case RTOS_TMR_BATCH_START:
+				return start_timer_owner(shard, ptmr, tick);
+
+			case RTOS_TMR_BATCH_STOP:
+				return stop_timer_owner(shard, ptmr);
+
+			default:
+				return del_timer_owner(shard, ptmr);
+		}
+	}
+
+	state = timer_state(ptmr);
+
+	if(state == RTOS_TMR_STATE_UNUSED) {
+		return RTOS_ERR_TMR_INACTIVE;
+	}
+
+	if((op == RTOS_TMR_BATCH_START) && (state == RTOS_TMR_STATE_RUNNING)) {
+		// No need to make any changes as it is already active
+		return RTOS_SUCCESS;
+	}
+
+	// The State Change also sets the Message Flag, link tells whether this Caller has to post the Timer
+	switch(op) {
+		case RTOS_TMR_BATCH_START:
+			// The Owner takes the Start Tick from the Message, so it is stored before the State publishes it
+			__atomic_store_n(&cold->RTOSTmrStartTick, tick, __ATOMIC_RELAXED);
+
+			if(timer_start_claim(ptmr, &err, &link) == RTOS_TRUE) {
+				// Wake the Owner only for a new nearest Deadline
+				match = timer_first_match(cold, tick);
+			}
+			break;
+
+		case RTOS_TMR_BATCH_STOP:
+			// A Stopped Timer never fires, the Owner may unlink it whenever it wakes up
+			timer_state_claim(ptmr, RTOS_TMR_STATE_STOPPED, &err, &link);
+			break;
+
+		default:
+			// The Owner gives the Timer back to the Pool when it next runs, so it is woken right away
+			timer_state_claim(ptmr, RTOS_TMR_STATE_UNUSED, &err, &link);
+			match = 0;
+			break;
+	}
+
+	if(err == RTOS_SUCCESS) {
+		shard_post(shard, ptmr, link, match);
+	}
+	return err;
+}
+
+// Run a Batch Operation, the Start Tick is read once
+INT32U timer_batch(RTOS_TMR **ptmrs, INT32U count, INT8U op, INT8U *perrs)
+{
+	INT32U i, j;
+	INT64U tick = 0;
+	INT32U done = 0;
+	TIMER_SHARD *shard;
+
+	// Check every Timer first, the valid ones are then done Shard by Shard
+	for(i = 0; i < count; i++) {
+		if(ptmrs[i] == NULL) {
+			perrs[i] = RTOS_ERR_TMR_INVALID;
+		}
+		else if(ptmrs[i]->RTOSTmrType != RTOS_TMR_TYPE) {
+			perrs[i] = RTOS_ERR_TMR_INVALID_TYPE;
+		}
+		else if((op == RTOS_TMR_BATCH_STOP) && (RTOSTmrCfg.RTOSTmrLazyCancel == RTOS_TRUE)) {
+			// Lazy Stop only flips the State, as RTOSTmrStop()
+			done += timer_state_claim(ptmrs[i], RTOS_TMR_STATE_STOPPED, &perrs[i], NULL);
+		}
+		else {
+			perrs[i] = RTOS_ERR_TMR_BATCH_PENDING;
+		}
+	}
+
+	// Every Timer of a Batch Start gets its Deadline from the same Tick
+	if(op == RTOS_TMR_BATCH_START) {
+		tick = get_current_tick();
+	}
+
+	for(i = 0; i < count; i++) {
+		if(perrs[i] != RTOS_ERR_TMR_BATCH_PENDING) {
+			continue;
+		}
+
+		// Do all the Timers of the Shard of the first waiting Timer
+		shard = timer_shard(ptmrs[i]);
+
+		for(j = i; j < count; j++) {
+			if((perrs[j] != RTOS_ERR_TMR_BATCH_PENDING) || (timer_shard(ptmrs[j]) != shard)) {
+				continue;
+			}
+
+			perrs[j] = timer_command(shard, ptmrs[j], op, tick);
+
+			if(perrs[j] == RTOS_SUCCESS) {
+				done++;
+			}
+		}
+	}
+
+	return done;
+}
+
+// Get the Shard owning a Timer
+TIMER_SHARD* timer_shard(RTOS_TMR *ptmr)
+{
+	return &timer_shards[timer_cold(ptmr)->RTOSTmrShard];
+}
+
+// Get the Shard of the CPU the calling Thread runs on
+INT32U caller_shard(void)
+{
+	int cpu;
+
+	if(RTOS_TMR_SHARDS == 1) {
+		return 0;
+	}
+
+	cpu = sched_getcpu();
+
+	if((cpu < 0) || (cpu >= CPU_SETSIZE)) {
+		return 0;
+	}
+	return RTOSTmrCpuShard[cpu];
+}
+
+// State of a Timer without its Message Flag
+INT8U timer_state(RTOS_TMR *ptmr)
+{
+	return __atomic_load_n(&ptmr->RTOSTmrState, __ATOMIC_SEQ_CST) & RTOS_TMR_STATE_MASK;
+}
+
+// Move the State of a Timer from one State to another, RTOS_FALSE when it was not in the from State.
+// The Owner of the Shard passes plink as NULL and keeps the Message Flag, any other Thread sets it in the same Compare
+// and Swap and gets *plink = RTOS_TRUE when it was clear, it then has to post the Timer to the Mailbox of its Shard
+INT8U timer_state_swap(RTOS_TMR *ptmr, INT8U from, INT8U to, INT8U *plink)
+{
+	INT8U state = __atomic_load_n(&ptmr->RTOSTmrState, __ATOMIC_SEQ_CST);
+
+	do {
+		if((state & RTOS_TMR_STATE_MASK) != from) {
+			return RTOS_FALSE;
+		}
+	} while(!__atomic_compare_exchange_n(&ptmr->RTOSTmrState, &state,
+		to | ((plink == NULL) ? (state & RTOS_TMR_STATE_MSG) : RTOS_TMR_STATE_MSG), RTOS_FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+	if(plink != NULL) {
+		*plink = ((state & RTOS_TMR_STATE_MSG) == 0) ? RTOS_TRUE : RTOS_FALSE;
+	}
+	return RTOS_TRUE;
+}
+
+// Claim a Stop (to = RTOS_TMR_STATE_STOPPED) or Delete (to = RTOS_TMR_STATE_UNUSED) of a Timer, only one Caller wins
+// (plink as timer_state_swap())
+INT8U timer_state_claim(RTOS_TMR *ptmr, INT8U to, INT8U *perr, INT8U *plink)
+{
+	INT8U state;
+
+	do {
+		state = timer_state(ptmr);
+
+		if(state == RTOS_TMR_STATE_UNUSED) {
+			*perr = RTOS_ERR_TMR_INACTIVE;
+			return RTOS_FALSE;
+		}
+
+		if((to == RTOS_TMR_STATE_STOPPED) && (state == RTOS_TMR_STATE_STOPPED)) {
+			*perr = RTOS_ERR_TMR_STOPPED;
+			return RTOS_FALSE;
+		}
+	} while(timer_state_swap(ptmr, state, to, plink) == RTOS_FALSE);
+
+	*perr = RTOS_SUCCESS;
+	return RTOS_TRUE;
+}
+
+// Post a Timer Started/Stopped/Deleted by another Thread to the Mailbox of its Shard, match is the Deadline it needs
+// (0 for a Delete, which has to reach the Pool).
+// link is RTOS_TRUE when the Caller set the Message Flag of the Timer, else it is already in the Mailbox
+void shard_post(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT8U link, INT64U match)
+{
+	RTOS_TMR_NODE *node = timer_node(ptmr);
+	INT64U head;
+	INT64U armed;
+	INT64U messages = 0;
+
+	// A Timer is in the Mailbox at most once, the owning Shard reads the latest State anyway
+	if(link == RTOS_TRUE) {
+		head = __atomic_load_n(&shard->mailbox, __ATOMIC_RELAXED);
+
+		do {
+			node->RTOSTmrMsgNext = (INT32U)head;
+			messages = (head >> 32) + 1;
+		} while(!__atomic_compare_exchange_n(&shard->mailbox, &head, (messages << 32) | (ptmr->RTOSTmrIndex + 1), RTOS_TRUE,
+			__ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+	}
+
+	// Only the Tickless Task sleeps past a Heartbeat, wake it when it sleeps beyond the Deadline, without any Deadline
+	// or the Mailbox fills up. It checks the Mailbox under its Mutex before it sleeps, so either it sees the Timer or
+	// the Signal comes after
+	if((RTOSTmrCfg.RTOSTmrTickSrc == RTOS_TMR_TICK_TICKLESS)
+		&& (__atomic_load_n(&shard->wheel.armed_valid, __ATOMIC_SEQ_CST) == RTOS_TRUE)) {
+		armed = __atomic_load_n(&shard->wheel.armed, __ATOMIC_RELAXED);
+
+		if((match < armed) || (armed == RTOS_TMR_NO_DEADLINE) || (messages == RTOS_TMR_MAILBOX_WAKE)) {
+			pthread_mutex_lock(&shard->mutex);
+			pthread_cond_signal(&shard->cond);
+			pthread_mutex_unlock(&shard->mutex);
+		}
+	}
+}
+
+// Apply the Starts, Stops and Deletes other Threads posted to the Mailbox (Owner of the Shard only)
+void shard_mailbox_process(TIMER_SHARD *shard)
+{
+	RTOS_TMR *temp_timer;
+	RTOS_TMR *next_timer;
+	RTOS_TMR_NODE *node;
+	INT8U state;
+	INT64U tick;
+	INT64U head;
+
+	head = __atomic_exchange_n(&shard->mailbox, 0, __ATOMIC_ACQUIRE);
+
+	if(head == 0) {
+		return;
+	}
+
+	temp_timer = timer_from_index((INT32U)head - 1);
+
+	// Every Start was posted at this Tick or before
+	tick = get_current_tick();
+
+	while(temp_timer != NULL) {
+		node = timer_node(temp_timer);
+		next_timer = (node->RTOSTmrMsgNext == 0) ? NULL : timer_from_index(node->RTOSTmrMsgNext - 1);
+
+		// Clear the Flag and read the State in one Step, any later State Change posts the Timer again
+		state = __atomic_and_fetch(&temp_timer->RTOSTmrState, RTOS_TMR_STATE_MASK, __ATOMIC_SEQ_CST);
+
+		if(state == RTOS_TMR_STATE_RUNNING) {
+			// Started, (re)link it from the Tick of its Start
+			timer_arm(shard, temp_timer, timer_start_tick(timer_cold(temp_timer), tick));
+		}
+		else {
+			remove_wheel_entry(shard, temp_timer);
+		}
+
+		// Free a Deleted Timer, no State Change and so no Message follows once it is Unused
+		if(state == RTOS_TMR_STATE_UNUSED) {
+			free_timer_obj(temp_timer);
+		}
+
+		temp_timer = next_timer;
+	}
+}
+
+// Timer Task of one Shard to Manage its Running Timers, the only Thread writing its Wheel
+void *RTOSTmrTask(void *temp)
+{
+	TIMER_SHARD *shard = (TIMER_SHARD*)temp;
+	INT64U beats;
+	INT64U offset;
+	INT64U now_tick;
+	INT64U now_ns;
+	INT64U deadline_ns;
+	struct timespec deadline;
+
+	timer_owner = shard;
+
+	while(__atomic_load_n(&RTOSTmrStopping, __ATOMIC_ACQUIRE) == RTOS_FALSE) {
+		if(RTOSTmrCfg.RTOSTmrTickSrc != RTOS_TMR_TICK_TICKLESS) {
+			if(RTOSTmrCfg.RTOSTmrTickSrc == RTOS_TMR_TICK_TIMERFD) {
+				// Wait for the timerfd, one read consumes every Heartbeat since the last one
+				while((read(shard->tick_fd, &beats, sizeof(beats)) < 0) && (errno == EINTR)) {
+				}
+			}
+			else {
+				// Wait for the signal from RTOSTmrSignal()
+				sem_wait(&shard->task_sem);
+
+				// Heartbeats which piled up while the Task was behind are covered by the Clock below
+				while(sem_trywait(&shard->task_sem) == 0) {
+				}
+			}
+
+			// Once got the Heartbeat, process the Messages and every Tick up to the Clock in one Pass
+			shard_mailbox_process(shard);
+			wheel_advance(shard, get_clock_tick());
+			continue;
+		}
+
+		// Tickless, catch up with the Messages and the Clock
+		__atomic_store_n(&shard->wheel.armed_valid, RTOS_FALSE, __ATOMIC_SEQ_CST);
+		shard_mailbox_process(shard);
+		wheel_advance(shard, get_clock_tick());
+
+		if(timer_queue->next_event(shard, &offset) == RTOS_FALSE) {
+			// No Timers, sleep until one is Started
+			__atomic_store_n(&shard->wheel.armed, RTOS_TMR_NO_DEADLINE, __ATOMIC_RELAXED);
+			__atomic_store_n(&shard->wheel.armed_valid, RTOS_TRUE, __ATOMIC_SEQ_CST);
+
+			pthread_mutex_lock(&shard->mutex);
+
+			if((__atomic_load_n(&shard->mailbox, __ATOMIC_SEQ_CST) == 0)
+				&& (__atomic_load_n(&RTOSTmrStopping, __ATOMIC_ACQUIRE) == RTOS_FALSE)) {
+				pthread_cond_wait(&shard->cond, &shard->mutex);
+			}
+
+			pthread_mutex_unlock(&shard->mutex);
+			continue;
+		}
+
+		if(offset >= RTOS_TMR_TICKLESS_MAX_SLEEP) {
+			offset = RTOS_TMR_TICKLESS_MAX_SLEEP - 1;
+		}
+
+		__atomic_store_n(&shard->wheel.armed, shard->tick_ctr + 1 + offset, __ATOMIC_RELAXED);
+		__atomic_store_n(&shard->wheel.armed_valid, RTOS_TRUE, __ATOMIC_SEQ_CST);
+
+		// Convert the Deadline Tick to the Monotonic Clock
+		now_ns = get_monotonic_ns();
+		now_tick = (now_ns - RTOSTmrEpochNs) / RTOS_TMR_TICK_NS;
+
+		if(shard->wheel.armed <= now_tick) {
+			// Already due
+			continue;
+		}
+
+		deadline_ns = now_ns - ((now_ns - RTOSTmrEpochNs) % RTOS_TMR_TICK_NS)
+			+ ((shard->wheel.armed - now_tick) * RTOS_TMR_TICK_NS);
+
+		deadline.tv_sec = deadline_ns / 1000000000ULL;
+		deadline.tv_nsec = deadline_ns % 1000000000ULL;
+
+		// Sleep until the Deadline or until a Message needs an earlier wakeup
+		pthread_mutex_lock(&shard->mutex);
+
+		if((__atomic_load_n(&shard->mailbox, __ATOMIC_SEQ_CST) == 0)
+			&& (__atomic_load_n(&RTOSTmrStopping, __ATOMIC_ACQUIRE) == RTOS_FALSE)) {
+			pthread_cond_timedwait(&shard->cond, &shard->mutex, &deadline);
+		}
+
+		pthread_mutex_unlock(&shard->mutex);
+	}
+
+	return temp;
+}
+
+// Create the Callback Executor Queue with size Cells (Power of 2)
+INT8U exec_queue_init(INT32U size)
+{
+	INT32U i;
+
+#if RTOS_CFG_STATIC && (RTOS_CFG_STATIC_EXEC_THREADS > 0)
+	exec_queue.cell = TmrStaticExecCell;
+#elif RTOS_CFG_STATIC
+	return RTOS_MALLOC_ERR;
+#else
+	if(posix_memalign((void**)&exec_queue.cell, RTOS_TMR_CACHE_LINE, sizeof(EXEC_CELL) * size) != 0) {
+		return RTOS_MALLOC_ERR;
+	}
+#endif
+
+	for(i = 0; i < size; i++) {
+		exec_queue.cell[i].seq = i;
+	}
+
+	exec_queue.mask = size - 1;
+	exec_queue.enqueue_pos = 0;
+	exec_queue.dequeue_pos = 0;
+
+	return RTOS_SUCCESS;
+}
+
+// Free the Callback Executor Queue
+void exec_queue_free(void)
+{
+#if !RTOS_CFG_STATIC
+	free(exec_queue.cell);
+#endif
+	exec_queue.cell = NULL;
+}
+
+// Put a Callback on the Executor Queue, RTOS_FALSE when it is full
+INT8U exec_queue_push(RTOS_TMR_CALLBACK callback, void *callback_arg, INT8 *name)
+{
+	EXEC_CELL *cell;
+	INT64U pos;
+	INT64 dif;
+
+	pos = __atomic_load_n(&exec_queue.enqueue_pos, __ATOMIC_RELAXED);
+
+	while(1) {
+		cell = &exec_queue.cell[pos & exec_queue.mask];
+		dif = (INT64)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - pos);
+
+		if(dif == 0) {
+			// Cell is free for this Position, claim it
+			if(__atomic_compare_exchange_n(&exec_queue.enqueue_pos, &pos, pos + 1, RTOS_TRUE,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				break;
+			}
+		}
+		else if(dif < 0) {
+			// Still holds a Callback of the previous lap, the Queue is full
+			return RTOS_FALSE;
+		}
+		else {
+			pos = __atomic_load_n(&exec_queue.enqueue_pos, __ATOMIC_RELAXED);
+		}
+	}
+
+	cell->callback = callback;
+	cell->callback_arg = callback_arg;
+	cell->name = name;
+	__atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+
+	// Wake an Executor Thread
+	sem_post(&exec_sem);
+	return RTOS_TRUE;
+}
+
+// Take a Callback from the Executor Queue, RTOS_FALSE when it is empty
+INT8U exec_queue_pop(RTOS_TMR_CALLBACK *callback, void **callback_arg, INT8 **name)
+{
+	EXEC_CELL *cell;
+	INT64U pos;
+	INT64 dif;
+
+	pos = __atomic_load_n(&exec_queue.dequeue_pos, __ATOMIC_RELAXED);
+
+	while(1) {
+		cell = &exec_queue.cell[pos & exec_queue.mask];
+		dif = (INT64)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - (pos + 1));
+
+		if(dif == 0) {
+			// Cell holds the Callback for this Position, claim it
+			if(__atomic_compare_exchange_n(&exec_queue.dequeue_pos, &pos, pos + 1, RTOS_TRUE,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				break;
+			}
+		}
+		else if(dif < 0) {
+			// Empty, unless a Producer claimed the Cell and is about to publish its Callback
+			if(__atomic_load_n(&exec_queue.enqueue_pos, __ATOMIC_ACQUIRE) == pos) {
+				return RTOS_FALSE;
+			}
+
+			// The Producer may have been preempted between its Claim and the Publish, give it the CPU
+			sched_yield();
+			pos = __atomic_load_n(&exec_queue.dequeue_pos, __ATOMIC_RELAXED);
+		}
+		else {
+			pos = __atomic_load_n(&exec_queue.dequeue_pos, __ATOMIC_RELAXED);
+		}
+	}
+
+	*callback = cell->callback;
+	*callback_arg = cell->callback_arg;
+	*name = cell->name;
+
+	// Free the Cell for the next lap
+	__atomic_store_n(&cell->seq, pos + exec_queue.mask + 1, __ATOMIC_RELEASE);
+	return RTOS_TRUE;
+}
+
+// Executor Thread to run the Callbacks handed over by the Timer Task
+void *RTOSTmrExecTask(void *temp)
+{
+	RTOS_TMR_CALLBACK callback;
+	void *callback_arg;
+	INT8 *name;
+
+	timer_executor = RTOS_TRUE;
+
+	while(1) {
+		// Wait for a Callback
+		sem_wait(&exec_sem);
+
+		// Run every queued Callback, the Wakeup of one another Thread took early is not lost
+		while(exec_queue_pop(&callback, &callback_arg, &name) == RTOS_TRUE) {
+			timer_callback_run(callback, callback_arg, name);
+		}
+
+		if(__atomic_load_n(&RTOSTmrStopping, __ATOMIC_ACQUIRE) == RTOS_TRUE) {
+			// Queue is drained, hand the Wakeup on so every other Executor Thread ends as well
+			sem_post(&exec_sem);
+			break;
+		}
+	}
+	return temp;
+}
+
+// Read the Monotonic Clock in ns
+INT64U get_monotonic_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((INT64U)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+// Get the Tick the Monotonic Clock is in
+INT64U get_clock_tick(void)
+{
+	return ((get_monotonic_ns() - RTOSTmrEpochNs) / RTOS_TMR_TICK_NS);
+}
+
+// Get the Tick new Deadlines count from, the first Tick Boundary not before the Clock. The Tick Counter of a Shard lags
+// the Clock by up to a Heartbeat, and the Tick the Clock is in has partly gone by, either would make a Timer fire early
+INT64U get_current_tick(void)
+{
+	return ((get_monotonic_ns() - RTOSTmrEpochNs) + RTOS_TMR_TICK_NS - 1) / RTOS_TMR_TICK_NS;
+}
+
+// Convert a Time in ns to Ticks, rounding up so a Timer never expires early
+INT8U ns_to_ticks(INT64U ns, INT64U *ticks)
+{
+	INT64U count;
+
+	count = (ns / RTOS_TMR_TICK_NS) + ((ns % RTOS_TMR_TICK_NS) != 0);
+
+	if(count > RTOS_TMR_TICKS_MAX) {
+		// The Match Tick could overflow the Tick Counter
+		return RTOS_FALSE;
+	}
+
+	*ticks = count;
+	return RTOS_TRUE;
+}
+
+// Fill up the Configuration with the Defaults
+void RTOSTmrCfgDefault(RTOS_TMR_CFG *cfg)
+{
+	cfg->RTOSTmrTickSrc = RTOS_TMR_TICK_SIGNAL;
+	cfg->RTOSTmrTickRate = RTOS_CFG_TMR_TASK_RATE;
+	cfg->RTOSTmrPoolGrow = RTOS_TRUE;
+	cfg->RTOSTmrHugePages = RTOS_FALSE;
+	cfg->RTOSTmrExecThreads = 0;
+	cfg->RTOSTmrExecQueueSize = RTOS_CFG_TMR_EXEC_QUEUE;
+	cfg->RTOSTmrShards = 1;
+	cfg->RTOSTmrAffinity = RTOS_FALSE;
+	cfg->RTOSTmrPoolSize = 0;
+	cfg->RTOSTmrMissPolicy = RTOS_TMR_MISS_FIRE_ALL;
+	cfg->RTOSTmrLazyCancel = RTOS_FALSE;
+	cfg->RTOSTmrCbBudgetNs = 0;
+	cfg->RTOSTmrCbDemote = 0;
+	cfg->RTOSTmrQueue = RTOS_TMR_QUEUE_WHEEL;
+	cfg->RTOSTmrHashBuckets = 0;
+	cfg->RTOSTmrDelayRangeNs = 0;
+
+#if RTOS_CFG_STATIC
+	// Fixed Fields of the Static Build
+	cfg->RTOSTmrTickRate = RTOS_CFG_STATIC_TICK_NS;
+	cfg->RTOSTmrPoolGrow = RTOS_FALSE;
+	cfg->RTOSTmrExecThreads = RTOS_CFG_STATIC_EXEC_THREADS;
+	cfg->RTOSTmrExecQueueSize = RTOS_CFG_STATIC_EXEC_QUEUE;
+	cfg->RTOSTmrShards = RTOS_CFG_STATIC_SHARDS;
+	cfg->RTOSTmrPoolSize = RTOS_CFG_STATIC_POOL;
+	cfg->RTOSTmrQueue = RTOS_CFG_STATIC_QUEUE;
+	cfg->RTOSTmrHashBuckets = RTOS_CFG_STATIC_HASH_BUCKETS;
+#endif
+}
+
+// Apply the Configuration, must be called before OSTickInitialize() and RTOSTmrInit()
+INT8U RTOSTmrConfigure(const RTOS_TMR_CFG *cfg, INT8U *perr)
+{
+	// ERROR Checking
+	if(cfg == NULL) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if(RTOSTmrInitDone == RTOS_TRUE) {
+		*perr = RTOS_ERR_TMR_INVALID_STATE;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrTickSrc < RTOS_TMR_TICK_SIGNAL) || (cfg->RTOSTmrTickSrc > RTOS_TMR_TICK_EXTERNAL)) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	// External mode takes no Locks, so everything has to stay in the one Thread of the Event Loop
+	if((cfg->RTOSTmrTickSrc == RTOS_TMR_TICK_EXTERNAL) && ((cfg->RTOSTmrShards != 1) || (cfg->RTOSTmrExecThreads > 0))) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrTickRate < RTOS_TMR_TICK_RATE_MIN) || (cfg->RTOSTmrTickRate > RTOS_TMR_TICK_RATE_MAX)) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrExecThreads > 0)
+		&& ((cfg->RTOSTmrExecQueueSize < 2) || ((cfg->RTOSTmrExecQueueSize & (cfg->RTOSTmrExecQueueSize - 1)) != 0))) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrShards < 1) || (cfg->RTOSTmrShards > RTOS_TMR_SHARD_MAX)) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrMissPolicy < RTOS_TMR_MISS_FIRE_ONCE) || (cfg->RTOSTmrMissPolicy > RTOS_TMR_MISS_SKIP)) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	// Demoted Callbacks need an Executor to go to
+	if((cfg->RTOSTmrCbDemote > 0) && ((cfg->RTOSTmrCbBudgetNs == 0) || (cfg->RTOSTmrExecThreads == 0))) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrQueue < RTOS_TMR_QUEUE_WHEEL) || (cfg->RTOSTmrQueue > RTOS_TMR_QUEUE_PAIRING)) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	// The Hash Queue only knows its next busy Bucket, whose Timers may be Laps ahead, so a Task or Event Loop sleeping
+	// until the next Deadline would wake once per Lap; it needs a Heartbeat
+	if((cfg->RTOSTmrQueue == RTOS_TMR_QUEUE_HASH)
+		&& ((cfg->RTOSTmrTickSrc == RTOS_TMR_TICK_TICKLESS) || (cfg->RTOSTmrTickSrc == RTOS_TMR_TICK_EXTERNAL))) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+	if((cfg->RTOSTmrHashBuckets != 0) && ((cfg->RTOSTmrHashBuckets < RTOS_TMR_HASH_MIN) || (cfg->RTOSTmrHashBuckets > RTOS_TMR_HASH_MAX)
+		|| ((cfg->RTOSTmrHashBuckets & (cfg->RTOSTmrHashBuckets - 1)) != 0))) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+
+#if RTOS_CFG_STATIC
+	// The Static Build only runs the Configuration it was compiled for
+	if((cfg->RTOSTmrTickRate != RTOS_CFG_STATIC_TICK_NS) || (cfg->RTOSTmrPoolGrow != RTOS_FALSE) || (cfg->RTOSTmrHugePages != RTOS_FALSE)
+		|| (cfg->RTOSTmrExecThreads != RTOS_CFG_STATIC_EXEC_THREADS) || (cfg->RTOSTmrExecQueueSize != RTOS_CFG_STATIC_EXEC_QUEUE)
+		|| (cfg->RTOSTmrShards != RTOS_CFG_STATIC_SHARDS) || (cfg->RTOSTmrPoolSize != RTOS_CFG_STATIC_POOL)
+		|| (cfg->RTOSTmrQueue != RTOS_CFG_STATIC_QUEUE) || (cfg->RTOSTmrHashBuckets != RTOS_CFG_STATIC_HASH_BUCKETS)) {
+		*perr = RTOS_ERR_TMR_INVALID_CFG;
+		return RTOS_FALSE;
+	}
+#endif
+
+	RTOSTmrCfg = *cfg;
+	RTOSTmrShardCount = RTOSTmrCfg.RTOSTmrShards;
+	timer_queue = &timer_queue_ops[RTOSTmrCfg.RTOSTmrQueue];
+
+	// Heartbeat is a whole number of Ticks, at least RTOS_CFG_TMR_HEARTBEAT_MIN long
+	RTOSTmrTicksPerBeat = (RTOS_CFG_TMR_HEARTBEAT_MIN + RTOS_TMR_TICK_NS - 1) / RTOS_TMR_TICK_NS;
+
+	*perr = RTOS_SUCCESS;
+	return RTOS_TRUE;
+}
+
+// Timer Initialization Function
+void RTOSTmrInit(void)
+{
+	INT32U timer_count = RTOSTmrCfg.RTOSTmrPoolSize;
+	INT8U	retVal;
+
+	if(timer_count == 0) {
+		fprintf(stdout,"\n\nHere Enter the number of Timers required in the Pool for the RTOS\n");
+		fprintf(stdout,"Timers = ");
+		scanf("%d", &timer_count);
+	}
+
+	retVal = timer_manager_start(timer_count);
+
+	if(retVal == RTOS_ERR_TMR_TICK) {
+		fprintf(stderr, "\nTick timerfd could not be created");
+		return;
+	}
+	else if(retVal != RTOS_SUCCESS) {
+		fprintf(stderr, "\nTimer Manager could not be started due to the Memory Error");
+		return;
+	}
+
+	// Pool Size is configured, keep stdout for the Application
+	if(RTOSTmrCfg.RTOSTmrPoolSize == 0) {
+		fprintf(stdout, "\nOkay %d Timers Created Successfully in the Pool for the RTOS", timer_count);
+		fprintf(stdout, "\n\n%u Timing Wheel(s) Initialized Successfully\n", RTOSTmrShardCount);
+		fprintf(stdout,"\nRTOS Initialization Done...\n");
+	}
+}
+
+// Configure and start the Timer Manager with its Tick Source, no Input and no Output, RTOS_SUCCESS or the Error
+INT8U RTOSTmrInitEx(const RTOS_TMR_CFG *cfg)
+{
+	INT8U	retVal;
+
+	if(RTOSTmrConfigure(cfg, &retVal) == RTOS_FALSE) {
+		return retVal;
+	}
+
+	retVal = timer_manager_start(RTOSTmrCfg.RTOSTmrPoolSize);
+
+	if(retVal != RTOS_SUCCESS) {
+		return retVal;
+	}
+
+	// The other Tick Sources were set up with the Shards
+	if(RTOSTmrCfg.RTOSTmrTickSrc == RTOS_TMR_TICK_SIGNAL) {
+		retVal = tick_signal_start();
+
+		if(retVal != RTOS_SUCCESS) {
+			RTOSTmrShutdown();
+			return retVal;
+		}
+	}
+	return RTOS_SUCCESS;
+}
+
+// Stop the Tick Source, end and join every Timer Task and Executor Thread and free the Shards and the Pool,
+// every Timer and Handle is gone after it; not from a Timer Task, an Executor Thread or a Callback
+INT8U RTOSTmrShutdown(void)
+{
+	INT32U i;
+	struct itimerspec time_value;
+
+	// A Timer Task or Executor Thread would join itself
+	if((RTOSTmrInitDone == RTOS_FALSE) || (timer_owner != NULL) || (timer_executor == RTOS_TRUE)) {
+		return RTOS_ERR_TMR_INVALID_STATE;
+	}
+
+	// No more Heartbeats
+	tick_signal_stop();
+
+	__atomic_store_n(&RTOSTmrStopping, RTOS_TRUE, __ATOMIC_SEQ_CST);
+
+	// Wake every Timer Task wherever it waits, a timerfd is made to expire right away
+	time_value.it_interval.tv_sec = 0;
+	time_value.it_interval.tv_nsec = 0;
+	time_value.it_value.tv_sec = 0;
+	time_value.it_value.tv_nsec = 1;
+
+	for(i = 0; i < RTOSTmrTaskCount; i++) {
+		sem_post(&timer_shards[i].task_sem);
+
+		if(timer_shards[i].tick_fd >= 0) {
+			timerfd_settime(timer_shards[i].tick_fd, 0, &time_value, NULL);
+		}
+
+		pthread_mutex_lock(&timer_shards[i].mutex);
+		pthread_cond_broadcast(&timer_shards[i].cond);
+		pthread_mutex_unlock(&timer_shards[i].mutex);
+
+		pthread_join(timer_shards[i].thread, NULL);
+	}
+	RTOSTmrTaskCount = 0;
+
+	// The Executor Threads run the Callbacks still queued, then pass this Wakeup on to each other to end
+	if(RTOSTmrCfg.RTOSTmrExecThreads > 0) {
+		sem_post(&exec_sem);
+
+		for(i = 0; i < RTOSTmrExecCount; i++) {
+			pthread_join(exec_threads[i], NULL);
+		}
+		RTOSTmrExecCount = 0;
+
+		sem_destroy(&exec_sem);
+		exec_queue_free();
+#if !RTOS_CFG_STATIC
+		free(exec_threads);
+#endif
+		exec_threads = NULL;
+	}
+
+	timer_manager_release();
+	return RTOS_SUCCESS;
+}
+
+// Create the Pool, the Shards, their Tick fds, the Executor and the Timer Tasks, prints nothing
+INT8U timer_manager_start(INT32U timer_count)
+{
+	INT32U i;
+	pthread_attr_t attr;
+	pthread_attr_t shard_attr;
+	cpu_set_t cpus;
+
+	if(Create_Timer_Pool(timer_count) != RTOS_SUCCESS) {
+		Destroy_Timer_Pool();
+		return RTOS_MALLOC_ERR;
+	}
+
+	// Create the Shards
+	if(init_timer_shards() != RTOS_SUCCESS) {
+		Destroy_Timer_Pool();
+		return RTOS_MALLOC_ERR;
+	}
+
+	// Tick 0 starts now
+	RTOSTmrEpochNs = get_monotonic_ns();
+
+	// Heartbeats of the timerfd Tick Sources, one per Timer Task or one for the Application
+	if(RTOSTmrCfg.RTOSTmrTickSrc == RTOS_TMR_TICK_TIMERFD) {
+		for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+			timer_shards[i].tick_fd = tick_fd_open(0);
+
+			if(timer_shards[i].tick_fd < 0) {
+				timer_manager_release();
+				return RTOS_ERR_TMR_TICK;
+			}
+		}
+	}
+	else if(RTOSTmrCfg.RTOSTmrTickSrc == RTOS_TMR_TICK_POLLED) {
+		RTOSTmrTickFd = tick_fd_open(TFD_NONBLOCK);
+
+		if(RTOSTmrTickFd < 0) {
+			timer_manager_release();
+			return RTOS_ERR_TMR_TICK;
+		}
+	}
+	__atomic_store_n(&RTOSTmrStopping, RTOS_FALSE, __ATOMIC_SEQ_CST);
+	RTOSTmrInitDone = RTOS_TRUE;
+
+	// Initialize the pthread Attributes
+	pthread_attr_init (&attr);
+
+	// Create the Callback Executor
+	if(RTOSTmrCfg.RTOSTmrExecThreads > 0) {
+		sem_init(&exec_sem, 0, 0);
+
+#if RTOS_CFG_STATIC && (RTOS_CFG_STATIC_EXEC_THREADS > 0)
+		exec_threads = TmrStaticExecThread;
+#elif !RTOS_CFG_STATIC
+		exec_threads = (pthread_t*) malloc(sizeof(pthread_t) * RTOSTmrCfg.RTOSTmrExecThreads);
+#endif
+
+		// Undo the whole Start, the configured Executor is part of it
+		if((exec_threads == NULL) || (exec_queue_init(RTOSTmrCfg.RTOSTmrExecQueueSize) != RTOS_SUCCESS)) {
+			pthread_attr_destroy (&attr);
+			exec_queue_free();
+#if !RTOS_CFG_STATIC
+			free(exec_threads);
+#endif
+			exec_threads = NULL;
+			sem_destroy(&exec_sem);
+			timer_manager_release();
+			return RTOS_MALLOC_ERR;
+		}
+
+		for(i = 0; i < RTOSTmrCfg.RTOSTmrExecThreads; i++) {
+			if(pthread_create (&exec_threads[i], &attr, &RTOSTmrExecTask, NULL) != 0) {
+				// The Executor Threads already running are joined
+				pthread_attr_destroy (&attr);
+				RTOSTmrShutdown();
+				return RTOS_MALLOC_ERR;
+			}
+			RTOSTmrExecCount = i + 1;
+		}
+	}
+	pthread_attr_destroy (&attr);
+
+	// Create a Timer Task per Shard, pinned to the CPU of its Shard when Affinity is configured,
+	// the Application Event Loop does their Job in Polled and External mode
+	for(i = 0; (i < RTOS_TMR_SHARDS) && (RTOSTmrCfg.RTOSTmrTickSrc < RTOS_TMR_TICK_POLLED); i++) {
+		pthread_attr_init (&shard_attr);
+
+		if(timer_shards[i].cpu >= 0) {
+			CPU_ZERO(&cpus);
+			CPU_SET(timer_shards[i].cpu, &cpus);
+			pthread_attr_setaffinity_np (&shard_attr, sizeof(cpus), &cpus);
+		}
+
+		if(pthread_create (&timer_shards[i].thread, &shard_attr, &RTOSTmrTask, &timer_shards[i]) != 0) {
+			// Undo the whole Start, the Tasks already running are joined
+			pthread_attr_destroy (&shard_attr);
+			RTOSTmrShutdown();
+			return RTOS_MALLOC_ERR;
+		}
+
+		pthread_attr_destroy (&shard_attr);
+		RTOSTmrTaskCount = i + 1;
+	}
+
+	// No Timer Task in Polled and External mode
+	if(RTOSTmrTaskCount > 0) {
+		thread = timer_shards[0].thread;
+	}
+
+	return RTOS_SUCCESS;
+}
+
+// Close the Tick fds, free the Shards and the Pool and mark the Timer Manager as not initialized
+void timer_manager_release(void)
+{
+	INT32U i;
+	TIMER_SHARD *shards = timer_shards;
+
+	if(RTOSTmrTickFd >= 0) {
+		close(RTOSTmrTickFd);
+		RTOSTmrTickFd = -1;
+	}
+
+	// RTOSTmrSignal() stops posting to the Shards before they go
+	__atomic_store_n(&timer_shards, NULL, __ATOMIC_RELEASE);
+
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		if(shards[i].tick_fd >= 0) {
+			close(shards[i].tick_fd);
+		}
+
+		heap_free(&shards[i]);
+		hash_free(&shards[i]);
+		sem_destroy(&shards[i].task_sem);
+		pthread_mutex_destroy(&shards[i].mutex);
+		pthread_cond_destroy(&shards[i].cond);
+	}
+	shards_free(shards);
+
+	Destroy_Timer_Pool();
+	TmrPoolHighWater = 0;
+
+	// The Watchdog starts again as well, the Names it kept may belong to the Timers just freed
+#if RTOS_CFG_TMR_STATS
+	pthread_mutex_lock(&timer_stats_mutex);
+	RTOSTmrStatsCbMaxNs = 0;
+	RTOSTmrStatsCbMaxName[0] = 0;
+	pthread_mutex_unlock(&timer_stats_mutex);
+#endif
+	pthread_mutex_lock(&timer_offender_mutex);
+	RTOSTmrOffenderCount = 0;
+	pthread_mutex_unlock(&timer_offender_mutex);
+	RTOSTmrOverruns = 0;
+	RTOSTmrDemoted = 0;
+
+	RTOSTmrInitDone = RTOS_FALSE;
+}
+
+// Push a Chain of Free Timers linked through RTOSTmrNext on the global Free Stack
+void free_stack_push(RTOS_TMR *first, RTOS_TMR *last, INT32U count)
+{
+	INT64U old_head;
+	INT64U new_head;
+
+	old_head = __atomic_load_n(&FreeTmrStackHead, __ATOMIC_RELAXED);
+
+	do {
+		// Chain goes on top of the current Top Timer
+		if((INT32U)old_head == 0) {
+			__atomic_store_n(&last->RTOSTmrNext, NULL, __ATOMIC_RELAXED);
+		}
+		else {
+			__atomic_store_n(&last->RTOSTmrNext, timer_from_index((INT32U)old_head - 1), __ATOMIC_RELAXED);
+		}
+
+		// Bump the Tag so a Pop racing with this Push can not succeed on a stale Top
+		new_head = (((old_head >> 32) + 1) << 32) | (first->RTOSTmrIndex + 1);
+	} while(!__atomic_compare_exchange_n(&FreeTmrStackHead, &old_head, new_head, RTOS_TRUE,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	__atomic_add_fetch(&FreeTmrCount, count, __ATOMIC_RELAXED);
+}
+
+// Pop one Timer from the global Free Stack
+RTOS_TMR* free_stack_pop(void)
+{
+	INT64U old_head;
+	INT64U new_head;
+	RTOS_TMR *top;
+	RTOS_TMR *next;
+
+	old_head = __atomic_load_n(&FreeTmrStackHead, __ATOMIC_ACQUIRE);
+
+	do {
+		if((INT32U)old_head == 0) {
+			// No timers left
+			return NULL;
+		}
+
+		// Timers are never given back to the Heap, so reading a Top popped by another Thread is safe, the Tag rejects it
+		top = timer_from_index((INT32U)old_head - 1);
+		next = __atomic_load_n(&top->RTOSTmrNext, __ATOMIC_RELAXED);
+
+		new_head = (((old_head >> 32) + 1) << 32) | ((next == NULL) ? 0 : (next->RTOSTmrIndex + 1));
+	} while(!__atomic_compare_exchange_n(&FreeTmrStackHead, &old_head, new_head, RTOS_TRUE,
+			__ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+	__atomic_sub_fetch(&FreeTmrCount, 1, __ATOMIC_RELAXED);
+
+	top->RTOSTmrNext = NULL;
+	return top;
+}
+
+// Give count Timers of the Thread Cache back to the global Free Stack in one Push
+void timer_cache_drain(TIMER_CACHE *cache, INT32U count)
+{
+	INT32U i;
+	RTOS_TMR *first;
+	RTOS_TMR *last;
+
+	if((count == 0) || (cache->list_ptr == NULL)) {
+		return;
+	}
+
+	first = last = cache->list_ptr;
+
+	for(i = 1; (i < count) && (last->RTOSTmrNext != NULL); i++) {
+		last = last->RTOSTmrNext;
+	}
+
+	cache->list_ptr = last->RTOSTmrNext;
+	cache->count -= i;
+
+	free_stack_push(first, last, i);
+}
+
+// Thread Exit, return the whole Thread Cache
+void timer_cache_exit(void *cache)
+{
+#if RTOS_CFG_TMR_STATS
+	TIMER_STATS_SLOT *slot = ((TIMER_CACHE*)cache)->stats;
+#endif
+
+	timer_cache_check((TIMER_CACHE*)cache);
+	timer_cache_drain((TIMER_CACHE*)cache, ((TIMER_CACHE*)cache)->count);
+
+#if RTOS_CFG_TMR_STATS
+	// Fold the Allocation Counters into the global ones and free the Slot for a new Thread
+	if(slot != NULL) {
+		__atomic_add_fetch(&RTOSTmrStatsAllocs, slot->allocs, __ATOMIC_RELAXED);
+		__atomic_add_fetch(&RTOSTmrStatsFrees, slot->frees, __ATOMIC_RELAXED);
+		__atomic_store_n(&slot->allocs, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&slot->frees, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&slot->in_use, RTOS_FALSE, __ATOMIC_RELEASE);
+		((TIMER_CACHE*)cache)->stats = NULL;
+	}
+#endif
+}
+
+// Forget the Timers of the Thread Cache when their Pool was destroyed since they were cached
+void timer_cache_check(TIMER_CACHE *cache)
+{
+	INT32U epoch = __atomic_load_n(&TmrPoolEpoch, __ATOMIC_ACQUIRE);
+
+	if(cache->epoch != epoch) {
+		cache->list_ptr = NULL;
+		cache->count = 0;
+		cache->epoch = epoch;
+	}
+}
+
+// Create the Key for the Thread Exit Drain
+void timer_cache_key_create(void)
+{
+	pthread_key_create(&timer_cache_key, &timer_cache_exit);
+}
+
+// Drain the Thread Cache when this Thread exits
+void timer_cache_register(TIMER_CACHE *cache)
+{
+	if(cache->registered == RTOS_FALSE) {
+		pthread_once(&timer_cache_once, &timer_cache_key_create);
+		pthread_setspecific(timer_cache_key, cache);
+#if RTOS_CFG_TMR_STATS
+		cache->stats = timer_stats_slot_claim();
+#endif
+		cache->registered = RTOS_TRUE;
+	}
+}
+
+// Refill the Thread Cache with a Batch from the global Free Stack
+void timer_cache_refill(TIMER_CACHE *cache)
+{
+	INT32U i;
+	RTOS_TMR *temp_ptr;
+
+	for(i = 0; i < RTOS_TMR_CACHE_BATCH; i++) {
+		temp_ptr = free_stack_pop();
+
+		if(temp_ptr == NULL) {
+			break;
+		}
+
+		temp_ptr->RTOSTmrNext = cache->list_ptr;
+		cache->list_ptr = temp_ptr;
+		cache->count++;
+	}
+
+	// Pool High Water Mark, only checked once per Batch
+	timer_stats_max(&TmrPoolHighWater, __atomic_load_n(&TmrPoolSize, __ATOMIC_RELAXED) - __atomic_load_n(&FreeTmrCount, __ATOMIC_RELAXED));
+}
+
+// Allocate a timer object from free timer pool
+RTOS_TMR* alloc_timer_obj(void)
+{
+	RTOS_TMR *temp_ptr = NULL;
+	TIMER_CACHE *cache = &timer_cache;
+
+	timer_cache_check(cache);
+
+	if(cache->list_ptr == NULL) {
+		timer_cache_refill(cache);
+
+		while((cache->list_ptr == NULL) && (RTOSTmrCfg.RTOSTmrPoolGrow == RTOS_TRUE)) {
+			// Pool is exhausted, add a Slab Chunk unless another Thread just did, again if others took it all
+			pthread_mutex_lock(&timer_pool_mutex);
+
+			if(((__atomic_load_n(&FreeTmrStackHead, __ATOMIC_ACQUIRE) & 0xFFFFFFFFULL) == 0)
+				&& (grow_timer_pool(RTOS_TMR_SLAB_CHUNK) != RTOS_SUCCESS)) {
+				pthread_mutex_unlock(&timer_pool_mutex);
+				break;
+			}
+
+			pthread_mutex_unlock(&timer_pool_mutex);
+
+			timer_cache_refill(cache);
+		}
+
+		if(cache->list_ptr == NULL) {
+			// No timers left
+			return NULL;
+		}
+		timer_cache_register(cache);
+	}
+
+	// Assign the Pointer from Top
+	temp_ptr = cache->list_ptr;
+
+	cache->list_ptr = temp_ptr->RTOSTmrNext;
+	cache->count--;
+
+	temp_ptr->RTOSTmrPrev = NULL;
+	temp_ptr->RTOSTmrNext = NULL;
+
+	timer_stats_count(cache, RTOS_TRUE);
+	return temp_ptr;
+}
+
+// Free the allocated timer object and put it back into free pool
+void free_timer_obj(RTOS_TMR *ptmr)
+{
+	RTOS_TMR_COLD *cold;
+
+	// Clear the Fields
+	cold = timer_cold(ptmr);
+
+	cold->RTOSTmrCallback = NULL;
+	cold->RTOSTmrCallbackArg = NULL;
+	cold->RTOSTmrDelay = 0;
+	cold->RTOSTmrPeriod = 0;
+	cold->RTOSTmrName = NULL;
+	cold->RTOSTmrOpt = 0;
+	cold->RTOSTmrShard = 0;
+	cold->RTOSTmrMiss = 0;
+	timer_node(ptmr)->RTOSTmrMsgNext = 0;
+	ptmr->RTOSTmrMatch = 0;
+
+	// Every Handle of this use of the Timer goes Stale, Generation 0 is never used
+	__atomic_store_n(&cold->RTOSTmrGen, (cold->RTOSTmrGen + 1 == 0) ? 1 : cold->RTOSTmrGen + 1, __ATOMIC_SEQ_CST);
+
+	// Change the State
+	__atomic_store_n(&ptmr->RTOSTmrState, RTOS_TMR_STATE_UNUSED, __ATOMIC_SEQ_CST);
+
+	// A Handle Call still holding the Timer gives it back with its last Pin
+	if(__atomic_or_fetch(&cold->RTOSTmrPins, RTOS_TMR_PIN_FREE, __ATOMIC_SEQ_CST) == RTOS_TMR_PIN_FREE) {
+		timer_pin_release(ptmr);
+	}
+}
+
+// Return a freed Timer to the Thread Cache
+void timer_cache_put(RTOS_TMR *ptmr)
+{
+	TIMER_CACHE *cache = &timer_cache;
+
+	timer_cache_check(cache);
+	timer_cache_register(cache);
+	timer_stats_count(cache, RTOS_FALSE);
+
+	ptmr->RTOSTmrPrev = NULL;
+
+	// The Owner of a Shard frees the Timers other Threads Deleted and a Timer Task never allocates, so they go
+	// straight back to the global Free Stack where every Thread can take them
+	if(timer_owner != NULL) {
+		free_stack_push(ptmr, ptmr, 1);
+		return;
+	}
+
+	ptmr->RTOSTmrNext = cache->list_ptr;
+
+	cache->list_ptr = ptmr;
+	cache->count++;
+
+	// Give a Batch back when the Cache grows too big
+	if(cache->count > RTOS_TMR_CACHE_MAX) {
+		timer_cache_drain(cache, RTOS_TMR_CACHE_BATCH);
+	}
+} 
+
+// Claim a free Slot of Allocation Counters for the calling Thread, NULL when every Slot is taken
+TIMER_STATS_SLOT* timer_stats_slot_claim(void)
+{
+#if RTOS_CFG_TMR_STATS
+	INT32U i;
+	INT8U expected;
+
+	for(i = 0; i < RTOS_TMR_STATS_THREADS; i++) {
+		expected = RTOS_FALSE;
+
+		if(__atomic_compare_exchange_n(&RTOSTmrStatsSlot[i].in_use, &expected, RTOS_TRUE, RTOS_FALSE,
+			__ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+			return &RTOSTmrStatsSlot[i];
+		}
+	}
+#endif
+	return NULL;
+}
+
+// Count an Allocation or a Free of the calling Thread
+void timer_stats_count(TIMER_CACHE *cache, INT8U alloc)
+{
+#if RTOS_CFG_TMR_STATS
+	TIMER_STATS_SLOT *slot = cache->stats;
+
+	if(slot == NULL) {
+		// No Slot of its own, share the global Counters
+		__atomic_add_fetch(alloc ? &RTOSTmrStatsAllocs : &RTOSTmrStatsFrees, 1, __ATOMIC_RELAXED);
+	}
+	else if(alloc) {
+		__atomic_store_n(&slot->allocs, slot->allocs + 1, __ATOMIC_RELAXED);
+	}
+	else {
+		__atomic_store_n(&slot->frees, slot->frees + 1, __ATOMIC_RELAXED);
+	}
+#else
+	(void)cache;
+	(void)alloc;
+#endif
+}
+
+// Raise max to value, RTOS_TRUE when value is the new Maximum
+INT8U timer_stats_max(INT64U *max, INT64U value)
+{
+	INT64U old = __atomic_load_n(max, __ATOMIC_RELAXED);
+
+	while(value > old) {
+		if(__atomic_compare_exchange_n(max, &old, value, RTOS_TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+			return RTOS_TRUE;
+		}
+	}
+	return RTOS_FALSE;
+}
+
+// Keep the longest running Callback and the Name of its Timer
+void timer_stats_callback(INT64U ns, INT8 *name)
+{
+#if RTOS_CFG_TMR_STATS
+	if(timer_stats_max(&RTOSTmrStatsCbMaxNs, ns) == RTOS_TRUE) {
+		// A longer Callback may have raised the Maximum since, its Name is the one to keep
+		pthread_mutex_lock(&timer_stats_mutex);
+		if(__atomic_load_n(&RTOSTmrStatsCbMaxNs, __ATOMIC_RELAXED) == ns) {
+			if(name == NULL) {
+				RTOSTmrStatsCbMaxName[0] = 0;
+			} else {
+				strncpy(RTOSTmrStatsCbMaxName, name, RTOS_TMR_STATS_NAME_LEN - 1);
+				RTOSTmrStatsCbMaxName[RTOS_TMR_STATS_NAME_LEN - 1] = 0;
+			}
+		}
+		pthread_mutex_unlock(&timer_stats_mutex);
+	}
+#else
+	(void)ns;
+	(void)name;
+#endif
+}
+
+// Run a Callback, timed for the Statistics and the Watchdog, RTOS_TRUE when it ran over the Budget
+INT8U timer_callback_run(RTOS_TMR_CALLBACK callback, void *callback_arg, INT8 *name)
+{
+	INT64U start_ns;
+	INT64U run_ns;
+
+#if !RTOS_CFG_TMR_STATS
+	if(RTOSTmrCfg.RTOSTmrCbBudgetNs == 0) {
+		callback(callback_arg);
+		return RTOS_FALSE;
+	}
+#endif
+
+	start_ns = get_monotonic_ns();
+	callback(callback_arg);
+	run_ns = get_monotonic_ns() - start_ns;
+
+	timer_stats_callback(run_ns, name);
+
+	if((RTOSTmrCfg.RTOSTmrCbBudgetNs == 0) || (run_ns <= RTOSTmrCfg.RTOSTmrCbBudgetNs)) {
+		return RTOS_FALSE;
+	}
+
+	__atomic_add_fetch(&RTOSTmrOverruns, 1, __ATOMIC_RELAXED);
+	timer_offender_record(name, run_ns, RTOS_FALSE);
+	return RTOS_TRUE;
+}
+
+// Enter a Run over the Budget in the Offender Table (ns = 0 only marks the Name as Demoted)
+void timer_offender_record(INT8 *name, INT64U ns, INT8U demoted)
+{
+	INT32U i;
+	INT32U victim = 0;
+	RTOS_TMR_OFFENDER *offender = NULL;
+
+	pthread_mutex_lock(&timer_offender_mutex);
+
+	for(i = 0; i < RTOSTmrOffenderCount; i++) {
+		if((RTOSTmrOffender[i].RTOSTmrName == name)
+			|| ((name != NULL) && (RTOSTmrOffender[i].RTOSTmrName != NULL) && (strcmp(RTOSTmrOffender[i].RTOSTmrName, name) == 0))) {
+			offender = &RTOSTmrOffender[i];
+			break;
+		}
+
+		if(RTOSTmrOffender[i].RTOSTmrOverruns < RTOSTmrOffender[victim].RTOSTmrOverruns) {
+			victim = i;
+		}
+	}
+
+	if(offender == NULL) {
+		// New Name, take a free Entry or the one with the fewest Overruns
+		offender = (RTOSTmrOffenderCount < RTOS_TMR_OFFENDER_MAX) ? &RTOSTmrOffender[RTOSTmrOffenderCount++] : &RTOSTmrOffender[victim];
+		memset(offender, 0, sizeof(RTOS_TMR_OFFENDER));
+		offender->RTOSTmrName = name;
+	}
+
+	if(ns > 0) {
+		offender->RTOSTmrOverruns++;
+		offender->RTOSTmrLastNs = ns;
+
+		if(ns > offender->RTOSTmrWorstNs) {
+			offender->RTOSTmrWorstNs = ns;
+		}
+	}
+
+	if(demoted == RTOS_TRUE) {
+		offender->RTOSTmrDemoted = RTOS_TRUE;
+	}
+
+	pthread_mutex_unlock(&timer_offender_mutex);
+}
+
+// Count an Overrun of an Inline Callback, a repeat Offender moves to the Executor (Owner of the Shard only)
+void timer_watchdog_overrun(RTOS_TMR *ptmr, RTOS_TMR_COLD *cold)
+{
+	RTOS_TMR_NODE *node = timer_node(ptmr);
+
+	if(node->RTOSTmrOverruns < 0xFFFF) {
+		node->RTOSTmrOverruns++;
+	}
+
+	if((RTOSTmrCfg.RTOSTmrCbDemote == 0) || (RTOSTmrCfg.RTOSTmrExecThreads == 0)
+		|| (node->RTOSTmrOverruns < RTOSTmrCfg.RTOSTmrCbDemote) || ((cold->RTOSTmrOpt & RTOS_TMR_FLAG_INLINE) == 0)) {
+		return;
+	}
+
+	// Later Expiries hand the Callback to the Executor, keeping the Timer Task on time
+	cold->RTOSTmrOpt &= ~RTOS_TMR_FLAG_INLINE;
+
+	__atomic_add_fetch(&RTOSTmrDemoted, 1, __ATOMIC_RELAXED);
+	timer_offender_record(cold->RTOSTmrName, 0, RTOS_TRUE);
+}
+
+// Function to Setup the Timer of Linux which will provide the Clock Tick Interrupt to the Timer Manager Module
+void OSTickInitialize(void) {	
+	// The Tickless Timer Task keeps its own Deadlines, the timerfd Heartbeats are set up by RTOSTmrInit()
+	if(RTOSTmrCfg.RTOSTmrTickSrc != RTOS_TMR_TICK_SIGNAL) {
+		return;
+	}
+
+	if(tick_signal_start() != RTOS_SUCCESS) {
+		fprintf(stderr, "\nTick Timer could not be created");
+	}
+}
+
+// Start the SIGALRM Heartbeat of the Signal Tick Source, once
+INT8U tick_signal_start(void)
+{
+	struct itimerspec time_value;
+	INT64U heartbeat_ns;
+
+	if(RTOSTmrTickTimerValid == RTOS_TRUE) {
+		return RTOS_SUCCESS;
+	}
+
+	// Setup the time of the OS Heartbeat as one or more configured Ticks
+	heartbeat_ns = (INT64U)RTOS_TMR_TICK_NS * RTOSTmrTicksPerBeat;
+
+	time_value.it_interval.tv_sec = heartbeat_ns / 1000000000ULL;
+	time_value.it_interval.tv_nsec = heartbeat_ns % 1000000000ULL;
+
+	time_value.it_value = time_value.it_interval;
+
+	// Change the Action of SIGALRM to call a function RTOSTmrSignal()
+	signal(SIGALRM, &RTOSTmrSignal);
 
 	// Create the Timer Object
-	timer_create(CLOCK_REALTIME, NULL, &timer_id);
+	if(timer_create(CLOCK_REALTIME, NULL, &RTOSTmrTickTimer) != 0) {
+		return RTOS_ERR_TMR_TICK;
+	}
 
 	// Start the Timer
-	timer_settime(timer_id, 0, &time_value, NULL);
+	if(timer_settime(RTOSTmrTickTimer, 0, &time_value, NULL) != 0) {
+		timer_delete(RTOSTmrTickTimer);
+		return RTOS_ERR_TMR_TICK;
+	}
+
+	RTOSTmrTickTimerValid = RTOS_TRUE;
+	return RTOS_SUCCESS;
+}
+
+// Delete the SIGALRM Heartbeat, RTOSTmrSignal() stays the Handler so a late Signal is harmless
+void tick_signal_stop(void)
+{
+	if(RTOSTmrTickTimerValid == RTOS_TRUE) {
+		timer_delete(RTOSTmrTickTimer);
+		RTOSTmrTickTimerValid = RTOS_FALSE;
+	}
+}
+
+// Open a timerfd on the Monotonic Clock expiring every Heartbeat, returns -1 on Error
+INT32 tick_fd_open(INT32 flags)
+{
+	INT32 fd;
+	struct itimerspec time_value;
+	INT64U heartbeat_ns;
+
+	fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | flags);
+
+	if(fd < 0) {
+		return -1;
+	}
+
+	// Same Heartbeat as the SIGALRM Tick Source
+	heartbeat_ns = (INT64U)RTOS_TMR_TICK_NS * RTOSTmrTicksPerBeat;
+
+	time_value.it_interval.tv_sec = heartbeat_ns / 1000000000ULL;
+	time_value.it_interval.tv_nsec = heartbeat_ns % 1000000000ULL;
+	time_value.it_value = time_value.it_interval;
+
+	if(timerfd_settime(fd, 0, &time_value, NULL) < 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+// Get the fd to poll for readability in RTOS_TMR_TICK_POLLED mode, -1 in the other Tick Sources
+INT32 RTOSTmrTickFdGet(void)
+{
+	return RTOSTmrTickFd;
+}
+
+// Process the Timers of every Shard up to the Clock in RTOS_TMR_TICK_POLLED mode, call it when the Tick fd is readable.
+// Callbacks run in the calling Thread unless the Executor takes them, returns the Heartbeats since the last call
+INT64U RTOSTmrTickService(void)
+{
+	INT64U beats = 0;
+
+	if((RTOSTmrInitDone == RTOS_FALSE) || (RTOSTmrTickFd < 0)) {
+		return 0;
+	}
+
+	// Consume the Heartbeats, the Clock below covers all of them
+	if(read(RTOSTmrTickFd, &beats, sizeof(beats)) != sizeof(beats)) {
+		beats = 0;
+	}
+
+	shards_advance(get_clock_tick());
+	return beats;
+}
+
+// Get the Monotonic Clock Time in ns (CLOCK_MONOTONIC) of the nearest Deadline of every Shard, RTOS_TMR_NO_DEADLINE
+// when no Timer is Running. An External Event Loop waits until then and calls RTOSTmrProcessExpired()
+INT64U RTOSTmrNextDeadline(void)
+{
+	INT32U i;
+	INT64U offset;
+	INT64U tick;
+	INT64U deadline = RTOS_TMR_NO_DEADLINE;
+	INT8U owned;
+	TIMER_SHARD *shard;
+
+	// The Timer Tasks own the Wheels in the other Tick Sources
+	if((RTOSTmrInitDone == RTOS_FALSE) || (RTOSTmrCfg.RTOSTmrTickSrc < RTOS_TMR_TICK_POLLED)) {
+		return RTOS_TMR_NO_DEADLINE;
+	}
+
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		shard = &timer_shards[i];
+		owned = shard_lock(shard);
+
+		// Timers Started by other Threads count as well
+		shard_mailbox_process(shard);
+
+		// A Cascade may come first, waking up for it early only moves the Wheel on
+		if(timer_queue->next_event(shard, &offset) == RTOS_TRUE) {
+			tick = shard->tick_ctr + 1 + offset;
+
+			if(RTOSTmrEpochNs + (tick * RTOS_TMR_TICK_NS) < deadline) {
+				deadline = RTOSTmrEpochNs + (tick * RTOS_TMR_TICK_NS);
+			}
+		}
+
+		if(owned == RTOS_TRUE) {
+			shard_unlock(shard);
+		}
+	}
+	return deadline;
+}
+
+// Run the Callbacks of every Timer due at the Monotonic Clock Time now_ns inline in RTOS_TMR_TICK_EXTERNAL mode,
+// returns the next Deadline as RTOSTmrNextDeadline()
+INT64U RTOSTmrProcessExpired(INT64U now_ns)
+{
+	if((RTOSTmrInitDone == RTOS_FALSE) || (RTOSTmrCfg.RTOSTmrTickSrc != RTOS_TMR_TICK_EXTERNAL)) {
+		return RTOS_TMR_NO_DEADLINE;
+	}
+
+	if(now_ns > RTOSTmrEpochNs) {
+		shards_advance((now_ns - RTOSTmrEpochNs) / RTOS_TMR_TICK_NS);
+	}
+	return RTOSTmrNextDeadline();
+}
+
+// Process the Messages and every Tick up to the given Tick of every Shard from the calling Thread
+void shards_advance(INT64U tick)
+{
+	INT32U i;
+	INT8U owned;
+	TIMER_SHARD *shard;
+
+	for(i = 0; i < RTOS_TMR_SHARDS; i++) {
+		shard = &timer_shards[i];
+		owned = shard_lock(shard);
+
+		shard_mailbox_process(shard);
+		wheel_advance(shard, tick);
+
+		if(owned == RTOS_TRUE) {
+			shard_unlock(shard);
+		}
+	}
+}
+
+// Become the Owner of a Shard without a Timer Task, one Polling Thread at a time (the Event Loop always owns it in
+// External mode), RTOS_TRUE when the Ownership was taken and has to be given back by shard_unlock()
+INT8U shard_lock(TIMER_SHARD *shard)
+{
+	if(timer_is_owner(shard) == RTOS_TRUE) {
+		return RTOS_FALSE;
+	}
+
+	pthread_mutex_lock(&shard->mutex);
+	timer_owner = shard;
+	return RTOS_TRUE;
+}
+
+// Give up the Ownership of a Shard taken by shard_lock()
+void shard_unlock(TIMER_SHARD *shard)
+{
+	timer_owner = NULL;
+	pthread_mutex_unlock(&shard->mutex);
+}
+
+// RTOS_TRUE when the calling Thread owns the Wheel of the Shard and may change it directly
+INT8U timer_is_owner(TIMER_SHARD *shard)
+{
+	return ((RTOSTmrCfg.RTOSTmrTickSrc == RTOS_TMR_TICK_EXTERNAL) || (timer_owner == shard)) ? RTOS_TRUE : RTOS_FALSE;
 }
 
 void print_program_info(void)
@@ -2,20 +2,84 @@
 #ifndef TIMER_API_H
 #define TIMER_API_H
 
+#include <pthread.h>
+#include <semaphore.h>
 
 // Typedefines
 typedef unsigned char INT8U;
 typedef unsigned short int INT16U;
 typedef unsigned int INT32U;
+typedef unsigned long long INT64U;
 
 typedef char INT8;
 typedef short int INT16;
 typedef int INT32;
+typedef long long INT64;
 
 
-// OS Tick Time in ns
+// OS Tick Time in ns (Default, RTOSTmrConfigure() can change it)
 #define RTOS_CFG_TMR_TASK_RATE	100000000
 
+// Allowed range of the configured Tick Time in ns
+#define RTOS_TMR_TICK_RATE_MIN	1000
+#define RTOS_TMR_TICK_RATE_MAX	1000000000
+
+// Shortest SIGALRM Heartbeat in ns, finer Ticks are counted several per Heartbeat
+#define RTOS_CFG_TMR_HEARTBEAT_MIN	1000000
+
+// Longest Delay/Period in Ticks, the 64 bit Tick Counter never reaches a Match Tick beyond it
+#define RTOS_TMR_TICKS_MAX	(1ULL << 62)
+
+// Longest Sleep of the Tickless Timer Task in Ticks, keeps the Wheel within reach of the Clock
+#define RTOS_TMR_TICKLESS_MAX_SLEEP	(1U << 30)
+
+// Pins of a Timer held by Handle Calls in flight, and the Flag of a Timer Deleted under them
+#define RTOS_TMR_PIN_COUNT	0x7FFF
+#define RTOS_TMR_PIN_FREE	0x8000
+
+// Per Thread Timer Cache, refilled from and drained to the global Free Stack in Batches
+#define RTOS_TMR_CACHE_BATCH	32
+#define RTOS_TMR_CACHE_MAX	(2 * RTOS_TMR_CACHE_BATCH)
+
+// Timer Slab, the Pool is carved from large Cache aligned Regions in Chunks of RTOS_TMR_SLAB_CHUNK Timers,
+// each Chunk holds the Hot Records followed by the Cold Records
+#define RTOS_TMR_SLAB_SHIFT		10
+#define RTOS_TMR_SLAB_CHUNK		(1 << RTOS_TMR_SLAB_SHIFT)
+#define RTOS_TMR_SLAB_MASK		(RTOS_TMR_SLAB_CHUNK - 1)
+#define RTOS_TMR_SLAB_MAX_CHUNKS	4096
+#define RTOS_TMR_SLAB_MAX_REGIONS	64
+#define RTOS_TMR_CACHE_LINE		64
+#define RTOS_TMR_HUGE_PAGE		(2 * 1024 * 1024)
+
+// Most Timer Shards, each has its own Timing Wheel, Lock and Timer Task
+#define RTOS_TMR_SHARD_MAX		256
+
+// Messages in the Mailbox of a Shard which wake its sleeping Tickless Timer Task to apply them
+#define RTOS_TMR_MAILBOX_WAKE		256
+
+// Shard of an RTOS_TMR_ATTR, place the Timer on the Shard of the calling CPU
+#define RTOS_TMR_SHARD_ANY		0xFFFF
+
+// Callback Executor Queue Size Default (Power of 2)
+#define RTOS_CFG_TMR_EXEC_QUEUE		1024
+
+// Statistics for RTOSTmrStatsGet(), 0 compiles the Counters out and every Statistic reads 0
+#ifndef RTOS_CFG_TMR_STATS
+#define RTOS_CFG_TMR_STATS		1
+#endif
+
+// Fire Lateness Histogram, Bucket 0 is on time and Bucket n counts 2^(n-1) to 2^n - 1 Ticks late
+#define RTOS_TMR_STATS_HIST		32
+
+// Threads with their own Allocation Counters, later Threads share a global Counter
+#define RTOS_TMR_STATS_THREADS		256
+
+// Characters kept of the Name of the Timer of the longest running Callback, with its terminating 0
+#define RTOS_TMR_STATS_NAME_LEN		32
+
+// Callback Watchdog, Timer Names kept in the Offender Table
+#define RTOS_TMR_OFFENDER_MAX		16
+
 // Lets assume RTOS Timer Type = 20
 #define RTOS_TMR_TYPE	20
 
@@ -29,9 +93,116 @@ typedef int INT32;
 #define	RTOS_TMR_STATE_RUNNING		3
 #define	RTOS_TMR_STATE_COMPLETED	4
 
+// Message Flag in RTOSTmrState, set by the same Compare and Swap that changes the State of a Timer posted to its Shard
+#define	RTOS_TMR_STATE_MSG		0x80
+#define	RTOS_TMR_STATE_MASK		0x7F
+
 // RTOS Timer Options
 #define RTOS_TMR_ONE_SHOT	1
 #define RTOS_TMR_PERIODIC	2
+#define RTOS_TMR_OPT_TYPE_MASK	0x0F
+
+// RTOS Timer Flags, OR'ed into the Option of RTOSTmrCreate()
+#define RTOS_TMR_FLAG_INLINE	0x80	/* Run the Callback in the Timer Task even when the Executor is enabled */
+
+// Missed Period Policies of Periodic Timers, when a Pass of the Timer Task covers more than one Period
+#define RTOS_TMR_MISS_DEFAULT		0	/* RTOS_TMR_ATTR only, use cfg.RTOSTmrMissPolicy */
+#define RTOS_TMR_MISS_FIRE_ONCE		1	/* Fire once, the next Period starts now */
+#define RTOS_TMR_MISS_FIRE_ALL		2	/* Fire once for every Period which ended */
+#define RTOS_TMR_MISS_SKIP		3	/* Fire once, drop the missed Periods and stay on the original Grid */
+
+// RTOS Tick Sources
+#define RTOS_TMR_TICK_SIGNAL	1	/* Periodic SIGALRM Heartbeat, one Tick per Signal */
+#define RTOS_TMR_TICK_TICKLESS	2	/* Timer Task sleeps until the nearest Deadline */
+#define RTOS_TMR_TICK_TIMERFD	3	/* Periodic timerfd Heartbeat read by each Timer Task, no Signals */
+#define RTOS_TMR_TICK_POLLED	4	/* Periodic timerfd Heartbeat serviced by the Application Event Loop, no Timer Task */
+#define RTOS_TMR_TICK_EXTERNAL	5	/* Single Threaded Event Loop drives the Timers, no Timer Task, no Locks */
+
+// RTOS Timer Queues, the Structure holding the Running Timers of each Shard
+#define RTOS_TMR_QUEUE_WHEEL	1	/* Hierarchical Timing Wheel, O(1) Start/Stop, Timers cascade down the Levels */
+#define RTOS_TMR_QUEUE_HASH	2	/* Hash Table of Buckets by Match modulo its Size, each kept sorted by Match, Heartbeat only */
+#define RTOS_TMR_QUEUE_HEAP	3	/* 4-ary implicit Min-Heap in an Array, O(log n) Start/Stop */
+#define RTOS_TMR_QUEUE_PAIRING	4	/* Intrusive Pairing Heap, O(1) Start, O(log n) amortized Expiry/Stop */
+
+// Buckets of the Hash Table Queue, a Power of 2 sized at Init and doubled online
+#define RTOS_TMR_HASH_MIN		64
+#define RTOS_TMR_HASH_MAX		(1 << 22)
+
+// Timers per Bucket beyond which the Hash Table doubles
+#define RTOS_TMR_HASH_LOAD		4
+
+// Buckets of the old Hash Table moved per Tick or Start while it is rehashed
+#define RTOS_TMR_HASH_REHASH_STEP	16
+
+// First Size of the Heap Array of each Shard, doubled whenever it fills up
+#define RTOS_TMR_HEAP_INIT		1024
+
+// Static Build, the Configuration is fixed at Compile Time and all Storage is static Arrays, nothing is allocated;
+// RTOSTmrConfigure() only accepts the Configuration of RTOSTmrCfgDefault() with the Run Time Options changed
+#ifndef RTOS_CFG_STATIC
+#define RTOS_CFG_STATIC			0
+#endif
+
+#if RTOS_CFG_STATIC
+// Timers of the static Pool, whole Slab Chunks, it never grows
+#ifndef RTOS_CFG_STATIC_POOL
+#define RTOS_CFG_STATIC_POOL		RTOS_TMR_SLAB_CHUNK
+#endif
+
+// Tick Time in ns, a Power of 2 turns every Tick Conversion into a Shift
+#ifndef RTOS_CFG_STATIC_TICK_NS
+#define RTOS_CFG_STATIC_TICK_NS		RTOS_CFG_TMR_TASK_RATE
+#endif
+
+#ifndef RTOS_CFG_STATIC_SHARDS
+#define RTOS_CFG_STATIC_SHARDS		1
+#endif
+
+#ifndef RTOS_CFG_STATIC_QUEUE
+#define RTOS_CFG_STATIC_QUEUE		RTOS_TMR_QUEUE_WHEEL
+#endif
+
+// Buckets of the Hash Table of each Shard, it never grows
+#ifndef RTOS_CFG_STATIC_HASH_BUCKETS
+#define RTOS_CFG_STATIC_HASH_BUCKETS	1024
+#endif
+
+#ifndef RTOS_CFG_STATIC_EXEC_THREADS
+#define RTOS_CFG_STATIC_EXEC_THREADS	0
+#endif
+
+#ifndef RTOS_CFG_STATIC_EXEC_QUEUE
+#define RTOS_CFG_STATIC_EXEC_QUEUE	RTOS_CFG_TMR_EXEC_QUEUE
+#endif
+
+#if (RTOS_CFG_STATIC_POOL == 0) || ((RTOS_CFG_STATIC_POOL & RTOS_TMR_SLAB_MASK) != 0)
+#error "RTOS_CFG_STATIC_POOL must be a Multiple of RTOS_TMR_SLAB_CHUNK"
+#endif
+
+#if (RTOS_CFG_STATIC_TICK_NS < RTOS_TMR_TICK_RATE_MIN) || (RTOS_CFG_STATIC_TICK_NS > RTOS_TMR_TICK_RATE_MAX)
+#error "RTOS_CFG_STATIC_TICK_NS must be within RTOS_TMR_TICK_RATE_MIN and RTOS_TMR_TICK_RATE_MAX"
+#endif
+
+#if (RTOS_CFG_STATIC_SHARDS < 1) || (RTOS_CFG_STATIC_SHARDS > RTOS_TMR_SHARD_MAX)
+#error "RTOS_CFG_STATIC_SHARDS must be within 1 and RTOS_TMR_SHARD_MAX"
+#endif
+
+#if (RTOS_CFG_STATIC_QUEUE < RTOS_TMR_QUEUE_WHEEL) || (RTOS_CFG_STATIC_QUEUE > RTOS_TMR_QUEUE_PAIRING)
+#error "RTOS_CFG_STATIC_QUEUE must be one of the RTOS_TMR_QUEUE_xxx"
+#endif
+
+#if (RTOS_CFG_STATIC_HASH_BUCKETS < RTOS_TMR_HASH_MIN) || (RTOS_CFG_STATIC_HASH_BUCKETS > RTOS_TMR_HASH_MAX) \
+	|| ((RTOS_CFG_STATIC_HASH_BUCKETS & (RTOS_CFG_STATIC_HASH_BUCKETS - 1)) != 0)
+#error "RTOS_CFG_STATIC_HASH_BUCKETS must be a Power of 2 within RTOS_TMR_HASH_MIN and RTOS_TMR_HASH_MAX"
+#endif
+
+#if (RTOS_CFG_STATIC_EXEC_QUEUE < 2) || ((RTOS_CFG_STATIC_EXEC_QUEUE & (RTOS_CFG_STATIC_EXEC_QUEUE - 1)) != 0)
+#error "RTOS_CFG_STATIC_EXEC_QUEUE must be a Power of 2"
+#endif
+#endif
+
+// RTOSTmrNextDeadline() when no Timer is Running
+#define RTOS_TMR_NO_DEADLINE	0xFFFFFFFFFFFFFFFFULL
 
 // Error Code
 #define RTOS_ERR_NONE			0
@@ -47,63 +218,300 @@ typedef int INT32;
 #define RTOS_ERR_TMR_INVALID		9
 #define RTOS_ERR_TMR_STOPPED		10
 #define RTOS_ERR_TMR_NO_CALLBACK	11
+#define RTOS_ERR_TMR_INVALID_CFG	12
+#define RTOS_ERR_TMR_INVALID_SHARD	13
+#define RTOS_ERR_TMR_STALE		14	/* Handle of a Timer which was Deleted since */
+#define RTOS_ERR_TMR_TICK		15	/* Tick Source (POSIX Timer or timerfd) could not be set up */
+#define RTOS_ERR_TMR_BATCH_PENDING	0xFF	/* Internal, Timer of a Batch not yet processed, never returned */
 
 // RTOS Stop Options
 #define RTOS_TMR_OPT_NONE		1
 #define RTOS_TMR_OPT_CALLBACK		2
 #define RTOS_TMR_OPT_CALLBACK_ARG	3
 
-#define HASH_TABLE_SIZE		10
+// Batch Operations
+#define RTOS_TMR_BATCH_START		1
+#define RTOS_TMR_BATCH_STOP		2
+#define RTOS_TMR_BATCH_DEL		3
 
-// Timer Callback
-typedef void (*RTOS_TMR_CALLBACK)(void *p_arg);
+// Timing Wheel Geometry
+// RTOS_TMR_WHEEL_LEVELS levels of RTOS_TMR_WHEEL_SIZE slots, Level n slot covers 2^(n * RTOS_TMR_WHEEL_BITS) ticks
+#define RTOS_TMR_WHEEL_BITS		8
+#define RTOS_TMR_WHEEL_SIZE		(1 << RTOS_TMR_WHEEL_BITS)
+#define RTOS_TMR_WHEEL_MASK		(RTOS_TMR_WHEEL_SIZE - 1)
+#define RTOS_TMR_WHEEL_LEVELS		4
+#define RTOS_TMR_WHEEL_SPAN		(1ULL << (RTOS_TMR_WHEEL_LEVELS * RTOS_TMR_WHEEL_BITS))	/* Ticks covered by the whole Wheel */
 
-// OS Timer Object Structure
-typedef struct os_timer {
-	INT8U	RTOSTmrType;	/* Should Always be set to RTOS_TMR_TYPE for Timers*/
+// Longest Slack Granularity, 2^RTOS_TMR_SLACK_SHIFT_MAX Ticks
+#define RTOS_TMR_SLACK_SHIFT_MAX	31
 
-	RTOS_TMR_CALLBACK	RTOSTmrCallback;	/* Function to call when Timer Expires */
+// Pseudo Levels for Timers which are not in a Wheel Slot
+#define RTOS_TMR_WHEEL_QUEUED		0xFC	/* Timer is in the Hash Table or Heap of its Shard */
+#define RTOS_TMR_WHEEL_OVERFLOW		0xFD	/* Timer is due RTOS_TMR_WHEEL_SPAN or more Ticks ahead */
+#define RTOS_TMR_WHEEL_EXPIRED		0xFE	/* Timer is in the Expired List of the current Tick */
+#define RTOS_TMR_WHEEL_NONE		0xFF	/* Timer is not linked anywhere */
 
-	void	*RTOSTmrCallbackArg;	/* Callback Function Arguments */
+// Timer Callback
+typedef void (*RTOS_TMR_CALLBACK)(void *p_arg);
 
+// OS Timer Object Structure, the Hot Record walked by the Timer Task (32 bytes, two per Cache Line)
+typedef struct os_timer {
 	struct os_timer	*RTOSTmrNext;	/* Double Link List Pointers */
 	struct os_timer	*RTOSTmrPrev;
 
-	INT32U	RTOSTmrMatch;	/* Timer Expires when RTOSTmrTickCtr = RTOSTmrMatch */
+	INT64U	RTOSTmrMatch;	/* Timer Expires when the 64 bit Tick Counter of its Shard = RTOSTmrMatch */
 
-	INT32U	RTOSTmrDelay;	/* One Shot Timer - Time for one shot, Periodic Timer - Delay before periodic update starts */
+	INT32U	RTOSTmrIndex;	/* Index of the Timer in the Pool, also locates its Cold Record */
 
-	INT32U	RTOSTmrPeriod;	/* Period to repeat Timer*/
+	INT8U	RTOSTmrType;	/* Should Always be set to RTOS_TMR_TYPE for Timers*/
 
-	INT8	*RTOSTmrName;	/* Name to give to the Timer */
+	INT8U	RTOSTmrLevel;	/* Wheel Level holding the Timer (or RTOS_TMR_WHEEL_OVERFLOW/EXPIRED/NONE) */
 
-	INT8U	RTOSTmrOpt;	/* Timer Options */
+	INT8U	RTOSTmrSlot;	/* Slot of the Wheel Level holding the Timer */
 
 	INT8U	RTOSTmrState;	/* State of the Timer
 				   RTOS_TMR_STATE_UNUSED
 				   RTOS_TMR_STATE_STOPPED
 				   RTOS_TMR_STATE_RUNNING
-				   RTOS_TMR_STATE_COMPLETED	*/
+				   RTOS_TMR_STATE_COMPLETED
+				   or'd with RTOS_TMR_STATE_MSG while the Timer is in the Mailbox of its Shard */
 } RTOS_TMR;
 
-// Hash Table Entry Structure
-typedef struct hash_obj {
-	INT8U	timer_count;
-	RTOS_TMR *list_ptr;
-} HASH_OBJ;
+// Timer Handle, Generation of the Timer in the high 32 bits and its Pool Index in the low 32 bits
+typedef INT64U RTOS_TMR_HANDLE;
+
+#define RTOS_TMR_HANDLE_NONE	0
+
+// OS Timer Cold Record, only needed on Create/Start and when the Timer Expires
+typedef struct os_timer_cold {
+	RTOS_TMR_CALLBACK	RTOSTmrCallback;	/* Function to call when Timer Expires */
+
+	void	*RTOSTmrCallbackArg;	/* Callback Function Arguments */
+
+	INT8	*RTOSTmrName;	/* Name to give to the Timer */
+
+	INT64U	RTOSTmrDelay;	/* One Shot Timer - Time for one shot, Periodic Timer - Delay before periodic update starts */
+
+	INT64U	RTOSTmrPeriod;	/* Period to repeat Timer*/
+
+	INT64U	RTOSTmrStartTick;	/* Tick of the last Start, for a Start posted to the Mailbox */
+
+	INT32U	RTOSTmrGen;	/* Generation, bumped each time the Timer is freed so its older Handles go Stale */
+
+	INT32U	RTOSTmrLag;	/* Ticks the Slack moved RTOSTmrMatch past the Deadline */
+
+	INT8U	RTOSTmrOpt;	/* Timer Options and Flags */
+
+	INT8U	RTOSTmrMiss;	/* Missed Period Policy */
+
+	INT8U	RTOSTmrSlackShift;	/* Deadlines are rounded up to a multiple of 2^RTOSTmrSlackShift Ticks */
+
+	INT16U	RTOSTmrShard;	/* Shard owning the Timer */
+
+	INT16U	RTOSTmrPins;	/* Handle Calls holding the Timer, RTOS_TMR_PIN_FREE once it is Deleted under them,
+				   the last Pin then gives it back to the Pool */
+} RTOS_TMR_COLD;
+
+// OS Timer Node, the Links of the Heap Queues and the rarely used Fields which do not fit in the Hot and Cold Records
+typedef struct os_timer_node {
+	union {
+		struct os_timer	*RTOSTmrChild;	/* Pairing Heap, first Child (Siblings are linked through RTOSTmrNext/Prev) */
+
+		INT32U	RTOSTmrHeapPos;	/* 4-ary Heap, Position in the Heap Array */
+	};
+
+	INT32U	RTOSTmrMsgNext;	/* Index + 1 of the next Timer in the Mailbox of its Shard, 0 ends the Mailbox */
+
+	INT16U	RTOSTmrOverruns;	/* Callback Runs over the Budget of the Callback Watchdog */
+} RTOS_TMR_NODE;
+
+// 4-ary Heap Entry, the Match is kept next to the Timer so Sifting does not touch the Timers it compares
+typedef struct timer_heap_entry {
+	INT64U	match;
+	RTOS_TMR *timer;
+} TIMER_HEAP_ENTRY;
+
+// Hash Table of the Hash Queue, Buckets by Match modulo its Size, each sorted by Match
+typedef struct timer_hash_table {
+	RTOS_TMR **bucket;	/* First Timer of each Bucket, NULL Array without a Table */
+	RTOS_TMR **tail;	/* Last Timer of each Bucket */
+	INT64U	*bitmap;	/* Non Empty Buckets */
+	INT32U	mask;		/* Buckets - 1 */
+} TIMER_HASH_TABLE;
+
+// Timer Queue of a Shard, the Hierarchical Timing Wheel or the Queue chosen with cfg.RTOSTmrQueue
+typedef struct timer_wheel {
+	INT32U	timer_count[RTOS_TMR_WHEEL_LEVELS];		/* Number of Timers in each Level */
+	RTOS_TMR *slot[RTOS_TMR_WHEEL_LEVELS][RTOS_TMR_WHEEL_SIZE];	/* Timer Lists of each Level */
+	INT64U	bitmap[RTOS_TMR_WHEEL_LEVELS][RTOS_TMR_WHEEL_SIZE / 64];	/* Non Empty Slots of each Level */
+	RTOS_TMR *expired;					/* Timers being expired in the current Tick */
+	RTOS_TMR *overflow;					/* Timers due beyond the Top Level */
+	INT32U	overflow_count;
+	INT64U	armed;						/* Tick the Tickless Timer Task sleeps until, RTOS_TMR_NO_DEADLINE without Timers */
+	INT8U	armed_valid;					/* RTOS_TRUE while the Timer Task sleeps until armed */
+	INT32U	queue_count;					/* Timers in the Hash Table or Heap */
+	TIMER_HASH_TABLE hash;					/* Hash Table, RTOS_TMR_QUEUE_HASH */
+	TIMER_HASH_TABLE hash_old;				/* Table being moved into hash while it grows, no Buckets otherwise */
+	INT32U	hash_rehash;					/* Next Bucket of hash_old to move */
+	TIMER_HEAP_ENTRY *heap;					/* 4-ary Heap Array, RTOS_TMR_QUEUE_HEAP */
+	void	*heap_base;					/* Allocation of the Heap Array */
+	INT32U	heap_size;					/* Entries the Heap Array holds */
+	void	*heap_spare;					/* Larger Heap Array reserved by grow_timer_pool(), taken when the Heap is full */
+	RTOS_TMR *pairing;					/* Root of the Pairing Heap, RTOS_TMR_QUEUE_PAIRING */
+} TIMER_WHEEL;
+
+// Timer Shard, an independent Timing Wheel with its own Lock, Tick and Timer Task
+typedef struct timer_shard {
+	TIMER_WHEEL	wheel;
+	INT64U	tick_ctr;		/* Tick Counter of the Shard, never wraps */
+	INT32U	id;
+	INT32	cpu;			/* CPU the Timer Task is pinned to, -1 when not pinned */
+	INT64U	tick_busy_ns;		/* Time spent processing busy Ticks */
+	INT64U	tick_busy_count;	/* Busy Ticks processed */
+	INT64U	tick_busy_max_ns;	/* Longest Pass over busy Ticks */
+	INT64U	fired;			/* Callbacks fired */
+	INT64U	lateness[RTOS_TMR_STATS_HIST];	/* Fire Lateness Histogram in Ticks */
+	pthread_mutex_t	mutex;		/* Orders the Tickless Sleep against Messages, one Owner at a time in Polled mode */
+	pthread_cond_t	cond;		/* Wakes the Tickless Timer Task when a Message needs an earlier Deadline */
+	sem_t	task_sem;		/* Signals the Timer Task on every Heartbeat */
+	pthread_t	thread;
+	INT32	tick_fd;		/* timerfd read by the Timer Task in RTOS_TMR_TICK_TIMERFD mode, else -1 */
+	INT64U	mailbox __attribute__((aligned(RTOS_TMR_CACHE_LINE)));	/* Timers Started/Stopped/Deleted by other Threads,
+									   Messages in the high 32 bits, Index + 1 of the last one in the low */
+} TIMER_SHARD;
+
+// Timer Queue Operations, one Set per RTOS_TMR_QUEUE_xxx (Owner of the Shard only)
+typedef struct timer_queue_ops {
+	void	(*link)(TIMER_SHARD *shard, RTOS_TMR *timer_obj);		/* Add a Running Timer by its Match */
+	void	(*unlink)(TIMER_SHARD *shard, RTOS_TMR *timer_obj);	/* Remove a Timer linked by link() */
+	INT8U	(*next_event)(TIMER_SHARD *shard, INT64U *offset);	/* Ticks after the next Tick until work is due */
+	void	(*collect_tick)(TIMER_SHARD *shard, RTOS_TMR **tail);	/* Move the Timers due now to the Expired List */
+	const char *name;
+} TIMER_QUEUE_OPS;
+
+// Slab Region holding Chunks of Timers
+typedef struct timer_slab {
+	void	*base;
+	INT64U	size;		/* Bytes */
+	INT8U	mapped;		/* RTOS_TRUE when mmap()ed, else posix_memalign()ed */
+} TIMER_SLAB;
+
+// Per Thread Allocation Counters, written only by the owning Thread
+typedef struct timer_stats_slot {
+	INT64U	allocs __attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+	INT64U	frees;
+	INT8U	in_use;		/* RTOS_TRUE while a Thread owns the Slot */
+} TIMER_STATS_SLOT;
+
+// Per Thread Cache of Free Timers
+typedef struct timer_cache {
+	RTOS_TMR *list_ptr;	/* Free Timers linked through RTOSTmrNext */
+	INT32U	count;
+	INT8U	registered;	/* RTOS_TRUE once the Thread Exit Drain is set up */
+	TIMER_STATS_SLOT *stats;	/* Allocation Counters of the Thread, NULL when every Slot is taken */
+	INT32U	epoch;		/* Pool Epoch of the cached Timers, they are dropped once the Pool is destroyed */
+} TIMER_CACHE;
+
+// Callback Executor Queue Cell
+typedef struct exec_cell {
+	INT64U	seq;			/* Position this Cell is ready for */
+	RTOS_TMR_CALLBACK	callback;
+	void	*callback_arg;
+	INT8	*name;			/* Name of the Timer, for the Callback Statistics */
+} EXEC_CELL;
+
+// Bounded Multi Producer Multi Consumer Callback Queue
+typedef struct exec_queue {
+	EXEC_CELL *cell;
+	INT64U	mask;
+	INT64U	enqueue_pos __attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+	INT64U	dequeue_pos __attribute__((aligned(RTOS_TMR_CACHE_LINE)));
+} EXEC_QUEUE;
+
+// Timer Manager Configuration, applied by RTOSTmrConfigure() before RTOSTmrInit(), or passed to RTOSTmrInitEx()
+typedef struct os_timer_cfg {
+	INT8U	RTOSTmrTickSrc;	/* RTOS_TMR_TICK_SIGNAL to RTOS_TMR_TICK_EXTERNAL */
+	INT32U	RTOSTmrTickRate;	/* Tick Time in ns, RTOS_TMR_TICK_RATE_MIN to RTOS_TMR_TICK_RATE_MAX */
+	INT8U	RTOSTmrPoolGrow;	/* RTOS_TRUE to add a Slab Chunk when the Pool runs out */
+	INT8U	RTOSTmrHugePages;	/* RTOS_TRUE to back the Slab with Huge Pages when available */
+	INT32U	RTOSTmrExecThreads;	/* Callback Executor Threads, 0 runs every Callback in the Timer Task */
+	INT32U	RTOSTmrExecQueueSize;	/* Callback Executor Queue Size, Power of 2 */
+	INT32U	RTOSTmrShards;		/* Timer Shards, 1 to RTOS_TMR_SHARD_MAX */
+	INT8U	RTOSTmrAffinity;	/* RTOS_TRUE to pin the Timer Task of each Shard to its own CPU */
+	INT32U	RTOSTmrPoolSize;	/* Timers created at Init, 0 asks RTOSTmrInit() for the Number on stdin,
+					   RTOSTmrInitEx() then grows the Pool on Demand */
+	INT8U	RTOSTmrMissPolicy;	/* Missed Period Policy of Periodic Timers, RTOS_TMR_MISS_FIRE_ALL by Default */
+	INT8U	RTOSTmrLazyCancel;	/* RTOS_TRUE, RTOSTmrStop() only flips the State and the Wheel drops the Timer later */
+	INT64U	RTOSTmrCbBudgetNs;	/* Callback Time Budget of the Watchdog in ns, 0 turns the Watchdog off */
+	INT16U	RTOSTmrCbDemote;	/* Overruns after which an Inline Callback moves to the Executor, 0 never */
+	INT8U	RTOSTmrQueue;		/* Timer Queue of the Shards, RTOS_TMR_QUEUE_WHEEL to RTOS_TMR_QUEUE_PAIRING */
+	INT32U	RTOSTmrHashBuckets;	/* First Hash Table Size of each Shard, Power of 2, 0 sizes it from the Pool and Delay Range */
+	INT64U	RTOSTmrDelayRangeNs;	/* Longest usual Delay in ns for sizing the Hash Table, 0 if not known */
+} RTOS_TMR_CFG;
+
+// Timer Attributes for RTOSTmrCreateEx(), Times are in ns and rounded up to whole Ticks
+typedef struct os_timer_attr {
+	INT64U	RTOSTmrDelayNs;		/* One Shot Timer - Time for one shot, Periodic Timer - Delay before periodic update starts */
+	INT64U	RTOSTmrPeriodNs;	/* Period to repeat Timer */
+	INT8U	RTOSTmrOpt;		/* RTOS_TMR_ONE_SHOT or RTOS_TMR_PERIODIC, optionally with RTOS_TMR_FLAG_INLINE */
+	INT16U	RTOSTmrShard;		/* Shard to own the Timer, RTOS_TMR_SHARD_ANY for the Shard of the calling CPU */
+	INT8U	RTOSTmrMissPolicy;	/* Missed Period Policy, RTOS_TMR_MISS_DEFAULT for the configured one */
+	INT64U	RTOSTmrSlackNs;		/* Allowed Lateness, lets the Timer share a Deadline with nearby Timers */
+} RTOS_TMR_ATTR;
+
+// Timer Manager Statistics, a Snapshot summed over every Shard by RTOSTmrStatsGet()
+typedef struct os_timer_stats {
+	INT64U	RTOSTmrArmed[RTOS_TMR_WHEEL_LEVELS + 1];	/* Timers in each Wheel Level, the last Entry is the Overflow List,
+							   every Timer counts in Level 0 with the other Queues */
+	INT64U	RTOSTmrPoolTotal;	/* Timers in the Pool */
+	INT64U	RTOSTmrPoolFree;	/* Timers on the global Free Stack, the Thread Caches hold the rest of the unused ones */
+	INT64U	RTOSTmrPoolUsed;	/* Timers Created and not yet Deleted */
+	INT64U	RTOSTmrPoolHighWater;	/* Most Timers taken from the global Free Stack at once */
+	INT64U	RTOSTmrFired;		/* Callbacks fired, each missed Period counts */
+	INT64U	RTOSTmrTickBusyCount;	/* Busy Ticks processed */
+	INT64U	RTOSTmrTickBusyNs;	/* Time spent processing busy Ticks */
+	INT64U	RTOSTmrTickBusyMaxNs;	/* Longest Pass over busy Ticks */
+	INT64U	RTOSTmrExecQueueDepth;	/* Callbacks waiting for an Executor Thread */
+	INT64U	RTOSTmrLateness[RTOS_TMR_STATS_HIST];	/* Fire Lateness Histogram in Ticks */
+	INT64U	RTOSTmrCallbackMaxNs;	/* Longest running Callback */
+	INT8	RTOSTmrCallbackMaxName[RTOS_TMR_STATS_NAME_LEN];	/* Name of the Timer of the longest running Callback, cut to fit */
+	INT64U	RTOSTmrCallbackOverruns;	/* Callback Runs over cfg.RTOSTmrCbBudgetNs */
+	INT64U	RTOSTmrCallbackDemoted;	/* Inline Timers moved to the Executor by the Watchdog */
+} RTOS_TMR_STATS;
+
+// Callback Watchdog Offender, Callbacks over the Budget grouped by the Name of their Timer
+typedef struct os_timer_offender {
+	INT8	*RTOSTmrName;		/* Name of the Timer */
+	INT64U	RTOSTmrOverruns;	/* Runs over the Budget */
+	INT64U	RTOSTmrLastNs;		/* Time of the last Run over the Budget */
+	INT64U	RTOSTmrWorstNs;		/* Longest Run */
+	INT8U	RTOSTmrDemoted;		/* RTOS_TRUE once a Timer of this Name was moved to the Executor */
+} RTOS_TMR_OFFENDER;
 
 
 // TIMER MANAGER APIs
 
+extern void RTOSTmrCfgDefault(RTOS_TMR_CFG *cfg);
+
+extern INT8U RTOSTmrConfigure(const RTOS_TMR_CFG *cfg, INT8U *perr);
+
 extern void RTOSTmrInit(void);
 
+extern INT8U RTOSTmrInitEx(const RTOS_TMR_CFG *cfg);
+
+extern INT8U RTOSTmrShutdown(void);
+
 extern RTOS_TMR* RTOSTmrCreate(INT32U delay, INT32U period, INT8U option, RTOS_TMR_CALLBACK callback, void *callback_arg, INT8	*name, INT8U *err);
 
+extern void RTOSTmrAttrInit(RTOS_TMR_ATTR *attr);
+
+extern RTOS_TMR* RTOSTmrCreateEx(const RTOS_TMR_ATTR *attr, RTOS_TMR_CALLBACK callback, void *callback_arg, INT8 *name, INT8U *err);
+
 extern INT8U RTOSTmrDel(RTOS_TMR *ptmr, INT8U *perr);
 
 extern INT8* RTOSTmrNameGet(RTOS_TMR *ptmr, INT8U *perr);
 
-extern INT32U RTOSTmrRemainGet(RTOS_TMR *ptmr, INT8U *perr);
+extern INT64U RTOSTmrRemainGet(RTOS_TMR *ptmr, INT8U *perr);
 
 extern INT8U RTOSTmrStateGet(RTOS_TMR *ptmr, INT8U *perr);
 
@@ -111,21 +519,258 @@ extern INT8U RTOSTmrStart(RTOS_TMR *ptmr, INT8U *perr);
 
 extern INT8U RTOSTmrStop(RTOS_TMR *ptmr, INT8U opt, void *callback_arg, INT8U *perr);
 
+extern INT32U RTOSTmrStartBatch(RTOS_TMR **ptmrs, INT32U count, INT8U *perrs);
+
+extern INT32U RTOSTmrStopBatch(RTOS_TMR **ptmrs, INT32U count, INT8U opt, void *callback_arg, INT8U *perrs);
+
+extern INT32U RTOSTmrDelBatch(RTOS_TMR **ptmrs, INT32U count, INT8U *perrs);
+
+extern RTOS_TMR_HANDLE RTOSTmrHandleGet(RTOS_TMR *ptmr, INT8U *perr);
+
+extern INT8U RTOSTmrHandleStop(RTOS_TMR_HANDLE handle, INT8U opt, void *callback_arg, INT8U *perr);
+
+extern INT8U RTOSTmrHandleDel(RTOS_TMR_HANDLE handle, INT8U *perr);
+
+extern INT64U RTOSTmrHandleRemainGet(RTOS_TMR_HANDLE handle, INT8U *perr);
+
+extern INT8U RTOSTmrStatsGet(RTOS_TMR_STATS *pstats, INT8U *perr);
+
+extern INT32U RTOSTmrOffendersGet(RTOS_TMR_OFFENDER *poffenders, INT32U max, INT8U *perr);
+
 extern void RTOSTmrSignal(int signum);
 
+extern void OSTickInitialize(void);
+
+extern INT32 RTOSTmrTickFdGet(void);
+
+extern INT64U RTOSTmrTickService(void);
+
+extern INT64U RTOSTmrNextDeadline(void);
+
+extern INT64U RTOSTmrProcessExpired(INT64U now_ns);
+
+extern void print_program_info(void);
+
 // Internal Functions
+RTOS_TMR* create_timer_obj(INT64U delay, INT64U period, INT8U option, INT32U shard, RTOS_TMR_CALLBACK callback,
+	void *callback_arg, INT8 *name, INT8U *err);
+
 INT8U Create_Timer_Pool(INT32U timer_count);
 
-void init_hash_table(void);
+INT8U grow_timer_pool(INT32U timer_count);
+
+void Destroy_Timer_Pool(void);
+
+INT8U timer_manager_start(INT32U timer_count);
+
+void timer_manager_release(void);
+
+INT8U tick_signal_start(void);
+
+void tick_signal_stop(void);
+
+RTOS_TMR* timer_from_index(INT32U index);
+
+RTOS_TMR* timer_handle_pin(RTOS_TMR_HANDLE handle, INT8U *perr);
 
-void insert_hash_entry(RTOS_TMR *timer_obj);
+void timer_handle_unpin(RTOS_TMR *ptmr);
 
-void remove_hash_entry(RTOS_TMR *timer_obj);
+void timer_pin_release(RTOS_TMR *ptmr);
+
+RTOS_TMR_COLD* timer_cold(RTOS_TMR *ptmr);
+
+RTOS_TMR_NODE* timer_node(RTOS_TMR *ptmr);
+
+INT8U init_timer_shards(void);
+
+void shards_free(TIMER_SHARD *shards);
+
+void init_timer_wheel(TIMER_SHARD *shard);
+
+void insert_wheel_entry(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void remove_wheel_entry(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+RTOS_TMR** wheel_list_head(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void wheel_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void wheel_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void wheel_cascade(TIMER_SHARD *shard, INT8U level);
+
+void wheel_refill_overflow(TIMER_SHARD *shard);
+
+INT8U wheel_next_event(TIMER_SHARD *shard, INT64U *offset);
+
+void wheel_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail);
+
+void wheel_fire_expired(TIMER_SHARD *shard);
+
+void wheel_advance(TIMER_SHARD *shard, INT64U target_tick);
+
+void timer_queue_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void timer_expired_append(TIMER_SHARD *shard, RTOS_TMR *timer_obj, RTOS_TMR **tail);
+
+INT32U hash_size(void);
+
+void hash_table_carve(TIMER_HASH_TABLE *table, void *block, INT32U buckets);
+
+INT8U hash_table_alloc(TIMER_HASH_TABLE *table, INT32U buckets);
+
+void hash_table_insert(TIMER_HASH_TABLE *table, RTOS_TMR *timer_obj);
+
+void hash_table_remove(TIMER_HASH_TABLE *table, RTOS_TMR *timer_obj);
+
+TIMER_HASH_TABLE* hash_table_of(TIMER_SHARD *shard, INT64U match);
+
+INT8U hash_init(TIMER_SHARD *shard);
+
+void hash_free(TIMER_SHARD *shard);
+
+void hash_grow(TIMER_SHARD *shard);
+
+void hash_rehash_step(TIMER_SHARD *shard, INT32U buckets);
+
+void hash_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void hash_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+INT8U hash_next_event(TIMER_SHARD *shard, INT64U *offset);
+
+void hash_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail);
+
+INT8U heap_init(TIMER_SHARD *shard);
+
+INT8U heap_reserve(INT32U timer_count);
+
+void heap_free(TIMER_SHARD *shard);
+
+void heap_place(TIMER_SHARD *shard, INT32U pos, TIMER_HEAP_ENTRY entry);
+
+void heap_sift_up(TIMER_SHARD *shard, INT32U pos, TIMER_HEAP_ENTRY entry);
+
+void heap_sift_down(TIMER_SHARD *shard, INT32U pos, TIMER_HEAP_ENTRY entry);
+
+void heap_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void heap_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+INT8U heap_next_event(TIMER_SHARD *shard, INT64U *offset);
+
+void heap_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail);
+
+RTOS_TMR* pairing_meld(RTOS_TMR *first, RTOS_TMR *second);
+
+RTOS_TMR* pairing_merge_pairs(RTOS_TMR *first);
+
+void pairing_link(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+void pairing_unlink(TIMER_SHARD *shard, RTOS_TMR *timer_obj);
+
+INT8U pairing_next_event(TIMER_SHARD *shard, INT64U *offset);
+
+void pairing_collect_tick(TIMER_SHARD *shard, RTOS_TMR **tail);
+
+INT64U timer_first_match(RTOS_TMR_COLD *cold, INT64U tick);
+
+INT64U timer_start_tick(RTOS_TMR_COLD *cold, INT64U tick);
+
+void timer_arm(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT64U tick);
+
+INT8U timer_start_claim(RTOS_TMR *ptmr, INT8U *perr, INT8U *plink);
+
+INT8U start_timer_owner(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT64U tick);
+
+void timer_slack_align(RTOS_TMR *ptmr, RTOS_TMR_COLD *cold);
+
+INT8U stop_timer_owner(TIMER_SHARD *shard, RTOS_TMR *ptmr);
+
+INT8U del_timer_owner(TIMER_SHARD *shard, RTOS_TMR *ptmr);
+
+INT8U timer_command(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT8U op, INT64U tick);
+
+INT32U timer_batch(RTOS_TMR **ptmrs, INT32U count, INT8U op, INT8U *perrs);
+
+TIMER_SHARD* timer_shard(RTOS_TMR *ptmr);
+
+INT32U caller_shard(void);
+
+INT8U timer_state(RTOS_TMR *ptmr);
+
+INT8U timer_state_swap(RTOS_TMR *ptmr, INT8U from, INT8U to, INT8U *plink);
+
+INT8U timer_state_claim(RTOS_TMR *ptmr, INT8U to, INT8U *perr, INT8U *plink);
+
+void shard_post(TIMER_SHARD *shard, RTOS_TMR *ptmr, INT8U link, INT64U match);
+
+void shard_mailbox_process(TIMER_SHARD *shard);
+
+INT64U get_monotonic_ns(void);
+
+INT64U get_clock_tick(void);
+
+INT64U get_current_tick(void);
+
+INT8U ns_to_ticks(INT64U ns, INT64U *ticks);
 
 void* RTOSTmrTask(void *temp);
 
+INT32 tick_fd_open(INT32 flags);
+
+void shards_advance(INT64U tick);
+
+INT8U shard_lock(TIMER_SHARD *shard);
+
+void shard_unlock(TIMER_SHARD *shard);
+
+INT8U timer_is_owner(TIMER_SHARD *shard);
+
+INT8U exec_queue_init(INT32U size);
+
+void exec_queue_free(void);
+
+INT8U exec_queue_push(RTOS_TMR_CALLBACK callback, void *callback_arg, INT8 *name);
+
+INT8U exec_queue_pop(RTOS_TMR_CALLBACK *callback, void **callback_arg, INT8 **name);
+
+void* RTOSTmrExecTask(void *temp);
+
 RTOS_TMR* alloc_timer_obj(void);
 
 void free_timer_obj(RTOS_TMR *ptmr);
 
+void timer_cache_put(RTOS_TMR *ptmr);
+
+void free_stack_push(RTOS_TMR *first, RTOS_TMR *last, INT32U count);
+
+RTOS_TMR* free_stack_pop(void);
+
+void timer_cache_drain(TIMER_CACHE *cache, INT32U count);
+
+void timer_cache_exit(void *cache);
+
+void timer_cache_check(TIMER_CACHE *cache);
+
+void timer_cache_key_create(void);
+
+void timer_cache_register(TIMER_CACHE *cache);
+
+void timer_cache_refill(TIMER_CACHE *cache);
+
+TIMER_STATS_SLOT* timer_stats_slot_claim(void);
+
+void timer_stats_count(TIMER_CACHE *cache, INT8U alloc);
+
+INT8U timer_stats_max(INT64U *max, INT64U value);
+
+void timer_stats_callback(INT64U ns, INT8 *name);
+
+INT8U timer_callback_run(RTOS_TMR_CALLBACK callback, void *callback_arg, INT8 *name);
+
+void timer_offender_record(INT8 *name, INT64U ns, INT8U demoted);
+
+void timer_watchdog_overrun(RTOS_TMR *ptmr, RTOS_TMR_COLD *cold);
+
 #endif
@@ -0,0 +1,1364 @@
+// Benchmark file to Measure the Timer Manager, prints one JSON Object per Result
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <malloc.h>
+#include "TimerAPI.h"
+
+extern TIMER_SHARD *timer_shards;
+extern INT32U RTOSTmrShardCount;
+extern RTOS_TMR_CFG RTOSTmrCfg;
+extern const TIMER_QUEUE_OPS *timer_queue;
+extern __thread TIMER_CACHE timer_cache;
+
+// Timers linked for the Scan Benchmark
+#define BENCH_SCAN_TIMERS	(1 << 20)
+
+// Scan Passes, the best one is reported
+#define BENCH_SCAN_PASSES	5
+
+// Timers of the Queue Benchmark, half of them are Stopped again before the Queue is advanced
+#define BENCH_QUEUE_TIMERS	(1 << 18)
+
+// Queue Benchmark advances BENCH_QUEUE_WINDOW Ticks in Steps of BENCH_QUEUE_STEP, a 1 ms Heartbeat at a 10 us Tick
+#define BENCH_QUEUE_WINDOW	1000000ULL
+#define BENCH_QUEUE_STEP	100
+
+// Delay Distributions of the Queue Benchmark
+#define BENCH_DELAY_SHORT	1	/* 1 to 1000 Ticks */
+#define BENCH_DELAY_MIXED	2	/* 90 % of 1 to 1000 Ticks, 10 % of 10^5 to 10^8 Ticks */
+#define BENCH_DELAY_LONG	3	/* 10^8 to 10^9 Ticks, hours long Leases at a 10 us Tick */
+
+// Timers of the Wrap Check, due within BENCH_WRAP_WINDOW Ticks of BENCH_WRAP_LAPS 2^32 Tick Boundaries
+#define BENCH_WRAP_TIMERS	4096
+#define BENCH_WRAP_LAPS		3
+#define BENCH_WRAP_WINDOW	1500000ULL
+#define BENCH_WRAP_STEP		700	/* Longest Step the Shard is advanced by near a Boundary */
+#define BENCH_WRAP_HASH_BUCKETS	(1 << 20)	/* A Jump of 2^32 Ticks visits each busy Bucket of the Hash Queue 4096 times */
+
+// Timers of the Stress Check, Started, Stopped and Deleted by every Thread at once for BENCH_STRESS_OPS Operations per
+// Thread and Round, one Operation in BENCH_STRESS_DEL is a Delete
+#define BENCH_STRESS_TIMERS	64
+#define BENCH_STRESS_ROUNDS	10
+#define BENCH_STRESS_OPS	100000
+#define BENCH_STRESS_DEL	16384
+#define BENCH_STRESS_TICK_NS	1000000
+#define BENCH_STRESS_DLY_NS	10000000000ULL	/* Never expires during the Check */
+#define BENCH_STRESS_DRAIN_NS	50000000ULL	/* Time for the Timer Tasks to apply the last Messages */
+
+// One Shot Timers of the Early Check, Started BENCH_EARLY_GAP_NS apart with a Delay of BENCH_EARLY_DLY_NS on a 1 us
+// Tick, so their Deadlines fall anywhere within a Heartbeat and within a Tick
+#define BENCH_EARLY_TIMERS	500
+#define BENCH_EARLY_TICK_NS	1000
+#define BENCH_EARLY_DLY_NS	50000
+#define BENCH_EARLY_GAP_NS	7300
+
+// Fixed Pool of the Recycle Check, taken whole; each Round another Thread Deletes BENCH_RECYCLE_DEL of the Timers,
+// fewer than fill the Mailbox, and they are Created again
+#define BENCH_RECYCLE_TIMERS	1024
+#define BENCH_RECYCLE_DEL	100
+#define BENCH_RECYCLE_ROUNDS	5
+
+// Timers of the Cost Check, with Delays of 1 to 1000 Ticks, half of them are Stopped again before the Shard is advanced
+// BENCH_COST_TICKS single Ticks; every Figure is the Median of BENCH_COST_RUNS Runs. The Static Build has to be compiled
+// with RTOS_CFG_STATIC_POOL=BENCH_COST_POOL and RTOS_CFG_STATIC_TICK_NS=BENCH_COST_TICK_NS
+#define BENCH_COST_TIMERS	32768
+#define BENCH_COST_POOL		65536
+#define BENCH_COST_TICK_NS	1048576
+#define BENCH_COST_TICKS	1100
+#define BENCH_COST_RUNS		9
+
+// Figures of the Cost Check
+#define BENCH_COST_CREATE	0
+#define BENCH_COST_START	1
+#define BENCH_COST_STOP		2
+#define BENCH_COST_CLOCK	3
+#define BENCH_COST_TICK		4
+#define BENCH_COST_FIGURES	5
+
+// Tick Time of the Workloads in ns, the Timer Tasks run Tickless
+#define BENCH_TICK_NS		10000
+
+// Run Time of each timed Workload in ns
+#define BENCH_RUN_NS		500000000ULL
+
+// Timers each Thread keeps outstanding in the Cancel Workload, every BENCH_CANCEL_FIRE th one is left to fire
+#define BENCH_CANCEL_RING	1024
+#define BENCH_CANCEL_FIRE	100
+#define BENCH_CANCEL_DLY_NS	100000000ULL
+
+// Timeouts each Thread re-arms in the Cancel95 Workload, every BENCH_CANCEL95_FIRE th one (5 %) has 1 Tick and fires
+#define BENCH_CANCEL95_RING	1024
+#define BENCH_CANCEL95_FIRE	20
+
+// Periodic Timers of the Periodic Workload, Periods of 1 to BENCH_PERIODIC_MAX_MS ms
+#define BENCH_PERIODIC_TIMERS	10000
+#define BENCH_PERIODIC_MAX_MS	100
+
+// One Shot Timers per Thread in the Skewed Workload, BENCH_SKEW_LONG_PCT % of them are far out and get cancelled
+#define BENCH_SKEW_TIMERS	50000
+#define BENCH_SKEW_LONG_PCT	10
+
+// Lateness Histogram, Log Linear with 2^BENCH_HIST_SUB_BITS Buckets per Power of 2
+#define BENCH_HIST_SUB_BITS	5
+#define BENCH_HIST_SUB		(1 << BENCH_HIST_SUB_BITS)
+#define BENCH_HIST_BUCKETS	((64 - BENCH_HIST_SUB_BITS + 1) * BENCH_HIST_SUB)
+
+// Workloads
+#define BENCH_CHURN		1
+#define BENCH_CANCEL		2
+#define BENCH_PERIODIC		3
+#define BENCH_SKEWED		4
+#define BENCH_CANCEL95		5
+
+// Timer Object Layout before the Hot/Cold Split, all Fields in one Record
+typedef struct flat_timer {
+	RTOS_TMR_CALLBACK	RTOSTmrCallback;
+	void	*RTOSTmrCallbackArg;
+	struct flat_timer	*RTOSTmrNext;
+	struct flat_timer	*RTOSTmrPrev;
+	INT8	*RTOSTmrName;
+	INT32U	RTOSTmrMatch;
+	INT32U	RTOSTmrDelay;
+	INT32U	RTOSTmrPeriod;
+	INT32U	RTOSTmrIndex;
+	INT8U	RTOSTmrType;
+	INT8U	RTOSTmrOpt;
+	INT8U	RTOSTmrLevel;
+	INT8U	RTOSTmrSlot;
+	INT8U	RTOSTmrState;
+} FLAT_TMR;
+
+// Expected Fire Time of a Timer, the Callback Argument of the Workloads
+typedef struct bench_rec {
+	INT64U	due_ns;
+	INT64U	period_ns;
+} BENCH_REC;
+
+// Deadline Tick of a Timer of the Wrap Check and its Fires
+typedef struct bench_wrap_rec {
+	INT64U	due;
+	INT32U	fires;
+} BENCH_WRAP_REC;
+
+// Worker Thread of a Workload
+typedef struct bench_worker {
+	pthread_t	thread;
+	INT32U	id;
+	INT32U	thread_count;
+	INT8U	workload;
+	INT64U	ops;
+	INT64U	errors;
+	BENCH_REC	*recs;
+	RTOS_TMR	**timers;
+} BENCH_WORKER;
+
+// Lateness of every fired Timer, Callbacks of all Shards add to it
+INT64U bench_hist[BENCH_HIST_BUCKETS];
+INT64U bench_fired = 0;
+INT64U bench_early = 0;
+
+// Set to stop the timed Workloads
+INT8U bench_stop = RTOS_FALSE;
+
+// Timers of the Wrap Check, the Tick the Shard was advanced from and the Fires off their Deadline Tick
+BENCH_WRAP_REC bench_wrap_recs[BENCH_WRAP_TIMERS];
+RTOS_TMR *bench_wrap_timers[BENCH_WRAP_TIMERS];
+INT64U bench_wrap_from = 0;
+INT64U bench_wrap_off = 0;
+
+// Timers of the current Round of the Stress Check
+RTOS_TMR *bench_stress_timers[BENCH_STRESS_TIMERS];
+
+// Timers of the Early Check and their Expected Fire Times
+RTOS_TMR *bench_early_timers[BENCH_EARLY_TIMERS];
+BENCH_REC bench_early_recs[BENCH_EARLY_TIMERS];
+
+// Timers of the Recycle Check
+RTOS_TMR *bench_recycle_timers[BENCH_RECYCLE_TIMERS];
+
+// Timers of the Cost Check
+RTOS_TMR *bench_cost_timers[BENCH_COST_TIMERS];
+
+// Function to get a Timestamp in ns
+INT64U bench_now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((INT64U)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+// Sleep for ns, SIGALRM and friends can not cut it short
+void bench_sleep_ns(INT64U ns)
+{
+	INT64U end = bench_now_ns() + ns;
+
+	while(bench_now_ns() < end) {
+		usleep(1000);
+	}
+}
+
+// Function to Shuffle a List Order, so the Walk can not be prefetched
+void bench_shuffle(INT32U *order, INT32U count)
+{
+	INT32U i, j, temp;
+
+	for(i = 0; i < count; i++) {
+		order[i] = i;
+	}
+
+	srand(1);
+	for(i = count - 1; i > 0; i--) {
+		j = (((INT32U)rand() << 16) ^ (INT32U)rand()) % (i + 1);
+		temp = order[i];
+		order[i] = order[j];
+		order[j] = temp;
+	}
+}
+
+// Function to Print one Scan Result
+void bench_scan_report(const char *layout, const char *order, INT32U record_bytes, INT32U count, INT64U best_ns, INT32U matched)
+{
+	fprintf(stdout, "{\"bench\":\"scan\",\"layout\":\"%s\",\"order\":\"%s\",\"record_bytes\":%u,"
+		"\"timers_per_cache_line\":%.2f,\"timers\":%u,\"ns_per_timer\":%.3f,\"matched\":%u}\n",
+		layout, order, record_bytes, (double)RTOS_TMR_CACHE_LINE / record_bytes, count,
+		(double)best_ns / count, matched);
+}
+
+// Walk a Slot List the way the Timer Task does, comparing every Match, with the old Flat Layout
+void bench_scan_flat(INT32U *order, const char *order_name)
+{
+	INT32U i, pass, matched = 0;
+	INT64U start, elapsed, best = ~0ULL;
+	FLAT_TMR *timers;
+	FLAT_TMR *temp_timer;
+
+	if(posix_memalign((void**)&timers, RTOS_TMR_CACHE_LINE, sizeof(FLAT_TMR) * BENCH_SCAN_TIMERS) != 0) {
+		fprintf(stderr, "\nScan Benchmark could not allocate the Flat Timers");
+		return;
+	}
+	memset(timers, 0, sizeof(FLAT_TMR) * BENCH_SCAN_TIMERS);
+
+	for(i = 0; i < BENCH_SCAN_TIMERS; i++) {
+		timers[order[i]].RTOSTmrMatch = i;
+		timers[order[i]].RTOSTmrNext = (i + 1 < BENCH_SCAN_TIMERS) ? &timers[order[i + 1]] : NULL;
+	}
+
+	for(pass = 0; pass < BENCH_SCAN_PASSES; pass++) {
+		matched = 0;
+		start = bench_now_ns();
+
+		for(temp_timer = &timers[order[0]]; temp_timer != NULL; temp_timer = temp_timer->RTOSTmrNext) {
+			matched += (temp_timer->RTOSTmrMatch == pass);
+		}
+
+		elapsed = bench_now_ns() - start;
+		if(elapsed < best) {
+			best = elapsed;
+		}
+	}
+
+	bench_scan_report("flat", order_name, sizeof(FLAT_TMR), BENCH_SCAN_TIMERS, best, matched);
+	free(timers);
+}
+
+// Same Walk over the Hot Records of the Timer Pool
+void bench_scan_hot(INT32U *order, const char *order_name)
+{
+	INT32U i, pass, matched = 0;
+	INT64U start, elapsed, best = ~0ULL;
+	RTOS_TMR *temp_timer;
+
+	for(i = 0; i < BENCH_SCAN_TIMERS; i++) {
+		temp_timer = timer_from_index(order[i]);
+		temp_timer->RTOSTmrMatch = i;
+		temp_timer->RTOSTmrNext = (i + 1 < BENCH_SCAN_TIMERS) ? timer_from_index(order[i + 1]) : NULL;
+	}
+
+	for(pass = 0; pass < BENCH_SCAN_PASSES; pass++) {
+		matched = 0;
+		start = bench_now_ns();
+
+		for(temp_timer = timer_from_index(order[0]); temp_timer != NULL; temp_timer = temp_timer->RTOSTmrNext) {
+			matched += (temp_timer->RTOSTmrMatch == pass);
+		}
+
+		elapsed = bench_now_ns() - start;
+		if(elapsed < best) {
+			best = elapsed;
+		}
+	}
+
+	bench_scan_report("hot", order_name, sizeof(RTOS_TMR), BENCH_SCAN_TIMERS, best, matched);
+}
+
+// Timer Callback of the Queue Benchmark
+void bench_queue_fire(void *arg)
+{
+	(*(INT64U*)arg)++;
+}
+
+// Start, Stop and expire Timers of one Delay Distribution straight on a Shard with the given Timer Queue
+// and first Hash Table Size (0 sizes it from the Pool)
+void bench_queue(INT8U queue, INT32U buckets, INT8U delays, const char *delays_name, RTOS_TMR **timers)
+{
+	INT32U i;
+	INT64U seed = 1;
+	INT64U delay;
+	INT64U fired = 0;
+	INT64U start;
+	INT64U start_ns;
+	INT64U stop_ns;
+	INT64U advance_ns;
+	INT64U end_tick;
+	TIMER_SHARD *shard;
+	RTOS_TMR_CFG cfg;
+	INT8U err;
+
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrQueue = queue;
+	cfg.RTOSTmrHashBuckets = buckets;
+	cfg.RTOSTmrMissPolicy = RTOS_TMR_MISS_FIRE_ALL;
+
+	if((RTOSTmrConfigure(&cfg, &err) == RTOS_FALSE) || (init_timer_shards() != RTOS_SUCCESS)) {
+		fprintf(stderr, "\nQueue Benchmark could not set up the %s Queue\n", timer_queue->name);
+		return;
+	}
+	shard = &timer_shards[0];
+
+	for(i = 0; i < BENCH_QUEUE_TIMERS; i++) {
+		seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+		switch(delays) {
+			case BENCH_DELAY_SHORT:
+				delay = (seed >> 33) % 1000 + 1;
+				break;
+
+			case BENCH_DELAY_MIXED:
+				delay = (((seed >> 33) % 100) < 90) ? ((seed >> 40) % 1000 + 1) : ((seed >> 33) % 99900000 + 100000);
+				break;
+
+			default:
+				delay = (seed >> 33) % 900000000 + 100000000;
+				break;
+		}
+
+		timers[i] = create_timer_obj(delay, 0, RTOS_TMR_ONE_SHOT, 0, &bench_queue_fire, &fired, "queue", &err);
+
+		if(timers[i] == NULL) {
+			fprintf(stderr, "\nQueue Benchmark could not create its Timers, error = %d\n", err);
+			return;
+		}
+	}
+
+	// The Benchmark Thread plays the Timer Task, so Start/Stop go straight to the Queue
+	start = bench_now_ns();
+
+	for(i = 0; i < BENCH_QUEUE_TIMERS; i++) {
+		start_timer_owner(shard, timers[i], shard->tick_ctr);
+	}
+
+	start_ns = bench_now_ns() - start;
+	start = bench_now_ns();
+
+	for(i = 0; i < BENCH_QUEUE_TIMERS; i += 2) {
+		stop_timer_owner(shard, timers[i]);
+	}
+
+	stop_ns = bench_now_ns() - start;
+	end_tick = shard->tick_ctr + BENCH_QUEUE_WINDOW;
+	start = bench_now_ns();
+
+	while(shard->tick_ctr < end_tick) {
+		wheel_advance(shard, shard->tick_ctr + BENCH_QUEUE_STEP);
+	}
+
+	advance_ns = bench_now_ns() - start;
+
+	fprintf(stdout, "{\"bench\":\"queue\",\"queue\":\"%s\",\"buckets\":%u,\"delays\":\"%s\",\"timers\":%u,\"start_ns\":%.1f,\"stop_ns\":%.1f,"
+		"\"advance_ns\":%.1f,\"steps\":%llu,\"busy_ticks\":%llu,\"fired\":%llu}\n",
+		timer_queue->name, (shard->wheel.hash.bucket != NULL) ? (shard->wheel.hash.mask + 1) : 0, delays_name, BENCH_QUEUE_TIMERS, (double)start_ns / BENCH_QUEUE_TIMERS,
+		(double)stop_ns / (BENCH_QUEUE_TIMERS / 2), (double)advance_ns / (BENCH_QUEUE_WINDOW / BENCH_QUEUE_STEP),
+		BENCH_QUEUE_WINDOW / BENCH_QUEUE_STEP, shard->tick_busy_count, fired);
+	fflush(stdout);
+
+	for(i = 0; i < BENCH_QUEUE_TIMERS; i++) {
+		del_timer_owner(shard, timers[i]);
+	}
+
+	heap_free(shard);
+	hash_free(shard);
+	shards_free(timer_shards);
+	timer_shards = NULL;
+}
+
+// Timer Callback of the Wrap Check, a Timer must fire in the Step which covers its Deadline
+void bench_wrap_fire(void *arg)
+{
+	BENCH_WRAP_REC *rec = (BENCH_WRAP_REC*)arg;
+
+	rec->fires++;
+
+	if((rec->due <= bench_wrap_from) || (rec->due > timer_shards[0].tick_ctr)) {
+		bench_wrap_off++;
+	}
+}
+
+// Arm Timers due around several 2^32 Tick Boundaries straight on a Shard with the given Timer Queue, advance the Shard
+// across them in short Steps near each Boundary and in one Jump in between, returns the Timers not fired exactly once
+// in the Step of their Deadline
+INT32U bench_wrap(INT8U queue)
+{
+	INT32U i;
+	INT32U lap;
+	INT32U bad = 0;
+	INT64U seed = 1;
+	INT64U delay;
+	INT64U start;
+	INT64U target;
+	INT64U fired = 0;
+	TIMER_SHARD *shard;
+	RTOS_TMR_CFG cfg;
+	INT8U err;
+
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrQueue = queue;
+
+	// The Hash Queue comes around to each busy Bucket once per Lap, a large Table keeps the Laps of a Jump few
+	if(queue == RTOS_TMR_QUEUE_HASH) {
+		cfg.RTOSTmrHashBuckets = BENCH_WRAP_HASH_BUCKETS;
+	}
+
+	if((RTOSTmrConfigure(&cfg, &err) == RTOS_FALSE) || (init_timer_shards() != RTOS_SUCCESS)) {
+		fprintf(stderr, "\nWrap Check could not set up the %s Queue\n", timer_queue->name);
+		return BENCH_WRAP_TIMERS;
+	}
+	shard = &timer_shards[0];
+
+	// Tick Counter starts just before the first Boundary
+	start = (1ULL << 32) - BENCH_WRAP_WINDOW;
+	shard->tick_ctr = start;
+	bench_wrap_off = 0;
+
+	for(i = 0; i < BENCH_WRAP_TIMERS; i++) {
+		seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+		delay = ((INT64U)(i % BENCH_WRAP_LAPS) << 32) + ((seed >> 33) % (2 * BENCH_WRAP_WINDOW)) + 1;
+
+		bench_wrap_timers[i] = create_timer_obj(delay, 0, RTOS_TMR_ONE_SHOT, 0, &bench_wrap_fire, &bench_wrap_recs[i], "wrap", &err);
+
+		if(bench_wrap_timers[i] == NULL) {
+			fprintf(stderr, "\nWrap Check could not create its Timers, error = %d\n", err);
+			return BENCH_WRAP_TIMERS;
+		}
+
+		bench_wrap_recs[i].due = start + delay;
+		bench_wrap_recs[i].fires = 0;
+		start_timer_owner(shard, bench_wrap_timers[i], start);
+	}
+
+	for(lap = 0; lap < BENCH_WRAP_LAPS; lap++) {
+		// Nothing is due between the Windows, the Queue skips straight to the next one
+		target = start + ((INT64U)lap << 32);
+
+		if(target > shard->tick_ctr) {
+			bench_wrap_from = shard->tick_ctr;
+			wheel_advance(shard, target);
+		}
+
+		while(shard->tick_ctr < target + (2 * BENCH_WRAP_WINDOW)) {
+			seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+			bench_wrap_from = shard->tick_ctr;
+			wheel_advance(shard, shard->tick_ctr + ((seed >> 33) % BENCH_WRAP_STEP) + 1);
+		}
+	}
+
+	for(i = 0; i < BENCH_WRAP_TIMERS; i++) {
+		fired += bench_wrap_recs[i].fires;
+
+		if(bench_wrap_recs[i].fires != 1) {
+			bad++;
+		}
+		del_timer_owner(shard, bench_wrap_timers[i]);
+	}
+	bad += (INT32U)bench_wrap_off;
+
+	fprintf(stdout, "{\"bench\":\"wrap\",\"queue\":\"%s\",\"timers\":%u,\"boundaries\":%u,\"end_tick\":%llu,\"fired\":%llu,\"bad\":%u}\n",
+		timer_queue->name, BENCH_WRAP_TIMERS, BENCH_WRAP_LAPS, shard->tick_ctr, fired, bad);
+	fflush(stdout);
+
+	heap_free(shard);
+	hash_free(shard);
+	shards_free(timer_shards);
+	timer_shards = NULL;
+
+	return bad;
+}
+
+// Worker Thread of the Stress Check, Deleted Timers are not reused before the Round ends so later Calls on them fail
+void *bench_stress_worker(void *arg)
+{
+	BENCH_WORKER *worker = (BENCH_WORKER*)arg;
+	INT64U seed = worker->id + 1;
+	RTOS_TMR *timer_obj;
+	INT32U i;
+	INT8U err;
+
+	for(i = 0; i < BENCH_STRESS_OPS; i++) {
+		seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+		timer_obj = bench_stress_timers[(seed >> 33) % BENCH_STRESS_TIMERS];
+
+		if(((seed >> 40) % BENCH_STRESS_DEL) == 0) {
+			RTOSTmrDel(timer_obj, &err);
+		}
+		else if(((seed >> 50) & 1) == 0) {
+			RTOSTmrStart(timer_obj, &err);
+		}
+		else {
+			RTOSTmrStop(timer_obj, RTOS_TMR_OPT_NONE, NULL, &err);
+		}
+	}
+	worker->ops = BENCH_STRESS_OPS;
+
+	return worker;
+}
+
+// Start, Stop and Delete the same Timers from thread_count Threads through the Mailbox of their Shard with the given
+// Timer Queue, returns the Timers left Running but not armed plus the Timers which never went back to the Pool
+INT32U bench_stress(INT8U queue, INT32U thread_count)
+{
+	INT32U i;
+	INT32U round;
+	INT32U unarmed = 0;
+	INT32U leaked = 0;
+	BENCH_WORKER *workers;
+	RTOS_TMR_ATTR attr;
+	RTOS_TMR_STATS stats;
+	RTOS_TMR_CFG cfg;
+	INT8U state;
+	INT8U err;
+
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrTickSrc = RTOS_TMR_TICK_TIMERFD;
+	cfg.RTOSTmrTickRate = BENCH_STRESS_TICK_NS;
+	cfg.RTOSTmrQueue = queue;
+	cfg.RTOSTmrPoolSize = 4 * BENCH_STRESS_TIMERS;
+
+	workers = (BENCH_WORKER*) calloc(thread_count, sizeof(BENCH_WORKER));
+
+	if((workers == NULL) || (RTOSTmrInitEx(&cfg) != RTOS_SUCCESS)) {
+		fprintf(stderr, "\nStress Check could not start the Timer Manager\n");
+		free(workers);
+		return BENCH_STRESS_TIMERS;
+	}
+
+	RTOSTmrAttrInit(&attr);
+	attr.RTOSTmrDelayNs = BENCH_STRESS_DLY_NS;
+	attr.RTOSTmrOpt = RTOS_TMR_ONE_SHOT;
+
+	for(round = 0; round < BENCH_STRESS_ROUNDS; round++) {
+		for(i = 0; i < BENCH_STRESS_TIMERS; i++) {
+			bench_stress_timers[i] = RTOSTmrCreateEx(&attr, &bench_queue_fire, NULL, "stress", &err);
+
+			if(bench_stress_timers[i] == NULL) {
+				fprintf(stderr, "\nStress Check could not create its Timers, error = %d\n", err);
+				RTOSTmrShutdown();
+				free(workers);
+				return BENCH_STRESS_TIMERS;
+			}
+		}
+
+		for(i = 0; i < thread_count; i++) {
+			workers[i].id = (round * thread_count) + i;
+			pthread_create(&workers[i].thread, NULL, &bench_stress_worker, &workers[i]);
+		}
+
+		for(i = 0; i < thread_count; i++) {
+			pthread_join(workers[i].thread, NULL);
+		}
+
+		bench_sleep_ns(BENCH_STRESS_DRAIN_NS);
+
+		// A Running Timer has to be linked in its Queue once its Messages are applied
+		for(i = 0; i < BENCH_STRESS_TIMERS; i++) {
+			state = RTOSTmrStateGet(bench_stress_timers[i], &err);
+
+			if(state == RTOS_TMR_STATE_UNUSED) {
+				continue;
+			}
+
+			if((state == RTOS_TMR_STATE_RUNNING)
+				&& (__atomic_load_n(&bench_stress_timers[i]->RTOSTmrLevel, __ATOMIC_RELAXED) == RTOS_TMR_WHEEL_NONE)) {
+				unarmed++;
+			}
+			RTOSTmrDel(bench_stress_timers[i], &err);
+		}
+	}
+
+	// Every Timer is Deleted, the ones still taken from the Pool were lost by a Delete (reads 0 without RTOS_CFG_TMR_STATS)
+	bench_sleep_ns(BENCH_STRESS_DRAIN_NS);
+	RTOSTmrStatsGet(&stats, &err);
+	leaked = (INT32U)stats.RTOSTmrPoolUsed;
+
+	fprintf(stdout, "{\"bench\":\"stress\",\"queue\":\"%s\",\"threads\":%u,\"timers\":%u,\"rounds\":%u,\"unarmed\":%u,\"leaked\":%u}\n",
+		timer_queue->name, thread_count, BENCH_STRESS_TIMERS, BENCH_STRESS_ROUNDS, unarmed, leaked);
+	fflush(stdout);
+
+	RTOSTmrShutdown();
+	free(workers);
+
+	return unarmed + leaked;
+}
+
+// Worker Thread of the Recycle Check, Deletes the first Timers through the Mailbox of their Shard
+void *bench_recycle_worker(void *arg)
+{
+	INT32U i;
+	INT8U err;
+
+	for(i = 0; i < BENCH_RECYCLE_DEL; i++) {
+		RTOSTmrDel(bench_recycle_timers[i], &err);
+	}
+	return arg;
+}
+
+// Take the whole fixed Pool, Delete some Timers from another Thread and Create them again with the given Tick Source,
+// returns the Timers which did not go back to the Pool. No Timer is Running, so a Tickless Task sleeps without a Deadline
+INT32U bench_recycle(INT8U tick_src)
+{
+	INT32U i;
+	INT32U round;
+	INT32U count;
+	INT32U created;
+	INT32U lost = 0;
+	pthread_t thread;
+	RTOS_TMR_ATTR attr;
+	RTOS_TMR_CFG cfg;
+	INT8U err;
+
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrTickSrc = tick_src;
+	cfg.RTOSTmrTickRate = BENCH_STRESS_TICK_NS;
+	cfg.RTOSTmrPoolSize = BENCH_RECYCLE_TIMERS;
+	cfg.RTOSTmrPoolGrow = RTOS_FALSE;
+
+	if(RTOSTmrInitEx(&cfg) != RTOS_SUCCESS) {
+		fprintf(stderr, "\nRecycle Check could not start the Timer Manager\n");
+		return BENCH_RECYCLE_TIMERS;
+	}
+
+	RTOSTmrAttrInit(&attr);
+	attr.RTOSTmrDelayNs = BENCH_STRESS_DLY_NS;
+	attr.RTOSTmrOpt = RTOS_TMR_ONE_SHOT;
+
+	for(round = 0; round <= BENCH_RECYCLE_ROUNDS; round++) {
+		// The whole Pool the first Round, the Deleted Timers after that
+		count = (round == 0) ? BENCH_RECYCLE_TIMERS : BENCH_RECYCLE_DEL;
+		created = 0;
+
+		for(i = 0; i < count; i++) {
+			bench_recycle_timers[i] = RTOSTmrCreateEx(&attr, &bench_queue_fire, NULL, "recycle", &err);
+
+			if(bench_recycle_timers[i] != NULL) {
+				created++;
+			}
+		}
+
+		if(created != count) {
+			lost = count - created;
+			break;
+		}
+
+		if(round < BENCH_RECYCLE_ROUNDS) {
+			pthread_create(&thread, NULL, &bench_recycle_worker, NULL);
+			pthread_join(thread, NULL);
+
+			bench_sleep_ns(BENCH_STRESS_DRAIN_NS);
+		}
+	}
+
+	fprintf(stdout, "{\"bench\":\"recycle\",\"tick_src\":%u,\"timers\":%u,\"rounds\":%u,\"lost\":%u}\n",
+		tick_src, BENCH_RECYCLE_TIMERS, round, lost);
+	fflush(stdout);
+
+	RTOSTmrShutdown();
+
+	return lost;
+}
+
+// Compare two Figures of the Cost Check for qsort()
+int bench_cost_cmp(const void *a, const void *b)
+{
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+
+	return (x > y) - (x < y);
+}
+
+// Time Create, Start, Stop, the Clock Read and a Tick of the configured Queue on an External Tick Source, prints the
+// Median ns per Call and the Heap taken by RTOSTmrInitEx(), the Figures of the Static Build Table in the README
+INT32U bench_cost(void)
+{
+	INT32U i;
+	INT32U run;
+	INT32U figure;
+	INT64U seed;
+	INT64U fired;
+	INT64U start;
+	INT64U heap = 0;
+	volatile INT64U sink = 0;
+	double ns[BENCH_COST_FIGURES][BENCH_COST_RUNS];
+	struct mallinfo2 before;
+	struct mallinfo2 after;
+	TIMER_SHARD *shard;
+	RTOS_TMR_ATTR attr;
+	RTOS_TMR_CFG cfg;
+	INT8U err;
+
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrTickSrc = RTOS_TMR_TICK_EXTERNAL;
+	cfg.RTOSTmrTickRate = BENCH_COST_TICK_NS;
+	cfg.RTOSTmrPoolSize = BENCH_COST_POOL;
+	cfg.RTOSTmrPoolGrow = RTOS_FALSE;
+
+	for(run = 0; run < BENCH_COST_RUNS; run++) {
+		before = mallinfo2();
+
+		if(RTOSTmrInitEx(&cfg) != RTOS_SUCCESS) {
+			fprintf(stderr, "\nCost Check could not start the Timer Manager, a Static Build needs "
+				"RTOS_CFG_STATIC_POOL=%u and RTOS_CFG_STATIC_TICK_NS=%u\n", BENCH_COST_POOL, BENCH_COST_TICK_NS);
+			return 1;
+		}
+		after = mallinfo2();
+		heap = (after.uordblks + after.hblkhd) - (before.uordblks + before.hblkhd);
+		shard = &timer_shards[0];
+
+		RTOSTmrAttrInit(&attr);
+		attr.RTOSTmrOpt = RTOS_TMR_ONE_SHOT;
+		seed = 1;
+		fired = 0;
+
+		start = bench_now_ns();
+		for(i = 0; i < BENCH_COST_TIMERS; i++) {
+			seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+			attr.RTOSTmrDelayNs = (((seed >> 33) % 1000) + 1) * BENCH_COST_TICK_NS;
+			bench_cost_timers[i] = RTOSTmrCreateEx(&attr, &bench_queue_fire, &fired, "cost", &err);
+
+			if(bench_cost_timers[i] == NULL) {
+				fprintf(stderr, "\nCost Check could not create its Timers, error = %d\n", err);
+				RTOSTmrShutdown();
+				return 1;
+			}
+		}
+		ns[BENCH_COST_CREATE][run] = (double)(bench_now_ns() - start) / BENCH_COST_TIMERS;
+
+		start = bench_now_ns();
+		for(i = 0; i < BENCH_COST_TIMERS; i++) {
+			RTOSTmrStart(bench_cost_timers[i], &err);
+		}
+		ns[BENCH_COST_START][run] = (double)(bench_now_ns() - start) / BENCH_COST_TIMERS;
+
+		start = bench_now_ns();
+		for(i = 0; i < BENCH_COST_TIMERS; i += 2) {
+			RTOSTmrStop(bench_cost_timers[i], RTOS_TMR_OPT_NONE, NULL, &err);
+		}
+		ns[BENCH_COST_STOP][run] = (double)(bench_now_ns() - start) / (BENCH_COST_TIMERS / 2);
+
+		start = bench_now_ns();
+		for(i = 0; i < BENCH_COST_TIMERS; i++) {
+			sink += get_clock_tick();
+		}
+		ns[BENCH_COST_CLOCK][run] = (double)(bench_now_ns() - start) / BENCH_COST_TIMERS;
+
+		start = bench_now_ns();
+		for(i = 0; i < BENCH_COST_TICKS; i++) {
+			wheel_advance(shard, shard->tick_ctr + 1);
+		}
+		ns[BENCH_COST_TICK][run] = (double)(bench_now_ns() - start) / BENCH_COST_TICKS;
+
+		RTOSTmrShutdown();
+	}
+
+	for(figure = 0; figure < BENCH_COST_FIGURES; figure++) {
+		qsort(ns[figure], BENCH_COST_RUNS, sizeof(double), &bench_cost_cmp);
+	}
+
+	fprintf(stdout, "{\"bench\":\"cost\",\"build\":\"%s\",\"queue\":\"%s\",\"timers\":%u,\"pool\":%u,\"tick_ns\":%u,\"runs\":%u,"
+		"\"create_ns\":%.1f,\"start_ns\":%.1f,\"stop_ns\":%.1f,\"clock_tick_ns\":%.1f,\"tick_ns_avg\":%.1f,"
+		"\"fires_per_tick\":%.1f,\"init_heap_bytes\":%llu}\n",
+		RTOS_CFG_STATIC ? "static" : "default", timer_queue->name, BENCH_COST_TIMERS, BENCH_COST_POOL, BENCH_COST_TICK_NS,
+		BENCH_COST_RUNS, ns[BENCH_COST_CREATE][BENCH_COST_RUNS / 2], ns[BENCH_COST_START][BENCH_COST_RUNS / 2],
+		ns[BENCH_COST_STOP][BENCH_COST_RUNS / 2], ns[BENCH_COST_CLOCK][BENCH_COST_RUNS / 2],
+		ns[BENCH_COST_TICK][BENCH_COST_RUNS / 2], (double)fired / BENCH_COST_TICKS, heap);
+	fflush(stdout);
+
+	return 0;
+}
+
+// Get the Histogram Bucket of a Value
+INT32U bench_hist_bucket(INT64U value)
+{
+	INT32U msb;
+
+	if(value < BENCH_HIST_SUB) {
+		return (INT32U)value;
+	}
+
+	msb = 63 - __builtin_clzll(value);
+	return ((msb - BENCH_HIST_SUB_BITS + 1) << BENCH_HIST_SUB_BITS) + (INT32U)((value >> (msb - BENCH_HIST_SUB_BITS)) & (BENCH_HIST_SUB - 1));
+}
+
+// Get the lowest Value of a Histogram Bucket
+INT64U bench_hist_value(INT32U bucket)
+{
+	INT32U msb;
+
+	if(bucket < BENCH_HIST_SUB) {
+		return bucket;
+	}
+
+	msb = (bucket >> BENCH_HIST_SUB_BITS) + BENCH_HIST_SUB_BITS - 1;
+	return (INT64U)(BENCH_HIST_SUB + (bucket & (BENCH_HIST_SUB - 1))) << (msb - BENCH_HIST_SUB_BITS);
+}
+
+// Get a Percentile (0 to 1) of the Lateness Histogram
+INT64U bench_hist_percentile(double percentile)
+{
+	INT32U i;
+	INT64U seen = 0;
+	INT64U rank;
+
+	if(bench_fired == 0) {
+		return 0;
+	}
+
+	rank = (INT64U)(percentile * bench_fired);
+
+	for(i = 0; i < BENCH_HIST_BUCKETS; i++) {
+		seen += bench_hist[i];
+
+		if(seen > rank) {
+			return bench_hist_value(i);
+		}
+	}
+	return bench_hist_value(BENCH_HIST_BUCKETS - 1);
+}
+
+// Timer Callback of the Workloads, adds the Lateness to the Histogram
+void bench_fire(void *arg)
+{
+	BENCH_REC *rec = (BENCH_REC*)arg;
+	INT64U now = bench_now_ns();
+
+	if(now < rec->due_ns) {
+		__atomic_add_fetch(&bench_early, 1, __ATOMIC_RELAXED);
+		now = rec->due_ns;
+	}
+
+	__atomic_add_fetch(&bench_hist[bench_hist_bucket(now - rec->due_ns)], 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&bench_fired, 1, __ATOMIC_RELAXED);
+
+	// Next Expiry of a Periodic Timer
+	rec->due_ns += rec->period_ns;
+}
+
+// Create and Start a Timer, keeping its Expected Fire Time in rec
+RTOS_TMR* bench_start(BENCH_REC *rec, INT64U delay_ns, INT64U period_ns, INT64U *ops, INT64U *errors)
+{
+	RTOS_TMR_ATTR attr;
+	RTOS_TMR *timer_obj;
+	INT8U err;
+
+	RTOSTmrAttrInit(&attr);
+	attr.RTOSTmrDelayNs = delay_ns;
+	attr.RTOSTmrPeriodNs = period_ns;
+	attr.RTOSTmrOpt = (period_ns == 0) ? RTOS_TMR_ONE_SHOT : RTOS_TMR_PERIODIC;
+
+	rec->period_ns = period_ns;
+
+	timer_obj = RTOSTmrCreateEx(&attr, &bench_fire, rec, "bench", &err);
+
+	if(timer_obj == NULL) {
+		(*errors)++;
+		return NULL;
+	}
+
+	// A Periodic Timer without Delay first fires after one Period
+	rec->due_ns = bench_now_ns() + ((delay_ns == 0) ? period_ns : delay_ns);
+	RTOSTmrStart(timer_obj, &err);
+
+	*ops += 2;
+	return timer_obj;
+}
+
+// Stop and Delete a Timer, a Stop of an already expired One Shot Timer is not an Error
+void bench_cancel(RTOS_TMR *timer_obj, INT64U *ops, INT64U *errors)
+{
+	INT8U err;
+
+	RTOSTmrStop(timer_obj, RTOS_TMR_OPT_NONE, NULL, &err);
+
+	if(RTOSTmrDel(timer_obj, &err) == RTOS_FALSE) {
+		(*errors)++;
+	}
+
+	*ops += 2;
+}
+
+// Start One Shot Timers a few us apart with the given Tick Source and check none fires before its Delay has passed,
+// returns the Timers which fired early or never
+INT32U bench_early_check(INT8U tick_src)
+{
+	INT32U i;
+	INT64U ops = 0;
+	INT64U errors = 0;
+	INT64U fired;
+	INT64U next;
+	RTOS_TMR_CFG cfg;
+	INT8U err;
+
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrTickSrc = tick_src;
+	cfg.RTOSTmrTickRate = BENCH_EARLY_TICK_NS;
+	cfg.RTOSTmrPoolSize = BENCH_EARLY_TIMERS;
+
+	if(RTOSTmrInitEx(&cfg) != RTOS_SUCCESS) {
+		fprintf(stderr, "\nEarly Check could not start the Timer Manager\n");
+		return BENCH_EARLY_TIMERS;
+	}
+
+	memset(bench_hist, 0, sizeof(bench_hist));
+	bench_fired = 0;
+	bench_early = 0;
+
+	next = bench_now_ns();
+
+	for(i = 0; i < BENCH_EARLY_TIMERS; i++) {
+		bench_early_timers[i] = bench_start(&bench_early_recs[i], BENCH_EARLY_DLY_NS, 0, &ops, &errors);
+
+		// Spin, a Sleep would round the Gap up to the Scheduler
+		next += BENCH_EARLY_GAP_NS;
+
+		while(bench_now_ns() < next) {
+		}
+	}
+
+	bench_sleep_ns(BENCH_STRESS_DRAIN_NS);
+	fired = __atomic_load_n(&bench_fired, __ATOMIC_RELAXED);
+
+	fprintf(stdout, "{\"bench\":\"early\",\"tick_src\":%u,\"timers\":%u,\"fired\":%llu,\"early\":%llu,\"errors\":%llu,"
+		"\"late_p50_ns\":%llu,\"late_p999_ns\":%llu}\n",
+		tick_src, BENCH_EARLY_TIMERS, fired, bench_early, errors, bench_hist_percentile(0.50), bench_hist_percentile(0.999));
+	fflush(stdout);
+
+	for(i = 0; i < BENCH_EARLY_TIMERS; i++) {
+		if(bench_early_timers[i] != NULL) {
+			RTOSTmrDel(bench_early_timers[i], &err);
+		}
+	}
+	RTOSTmrShutdown();
+
+	return (INT32U)(bench_early + (BENCH_EARLY_TIMERS - fired));
+}
+
+// Worker Thread of the Workloads
+void *bench_worker(void *arg)
+{
+	BENCH_WORKER *worker = (BENCH_WORKER*)arg;
+	INT32U i;
+	INT32U slot;
+	INT64U seed = worker->id + 1;
+	RTOS_TMR *timer_obj;
+	INT8U err;
+
+	switch(worker->workload) {
+		case BENCH_CHURN:
+			// Create, Start, Stop and Delete a Timer of 1 ms to 1 s over and over
+			while(__atomic_load_n(&bench_stop, __ATOMIC_RELAXED) == RTOS_FALSE) {
+				seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+				timer_obj = bench_start(&worker->recs[0], ((seed >> 33) % 1000 + 1) * 1000000ULL, 0, &worker->ops, &worker->errors);
+
+				if(timer_obj != NULL) {
+					bench_cancel(timer_obj, &worker->ops, &worker->errors);
+				}
+			}
+			break;
+
+		case BENCH_CANCEL:
+			// Timeouts which are nearly all cancelled long before they expire
+			for(i = 0; __atomic_load_n(&bench_stop, __ATOMIC_RELAXED) == RTOS_FALSE; i++) {
+				slot = i & (BENCH_CANCEL_RING - 1);
+
+				if(worker->timers[slot] != NULL) {
+					bench_cancel(worker->timers[slot], &worker->ops, &worker->errors);
+				}
+
+				worker->timers[slot] = bench_start(&worker->recs[slot],
+					((i % BENCH_CANCEL_FIRE) == 0) ? BENCH_TICK_NS : BENCH_CANCEL_DLY_NS, 0, &worker->ops, &worker->errors);
+			}
+
+			for(slot = 0; slot < BENCH_CANCEL_RING; slot++) {
+				if(worker->timers[slot] != NULL) {
+					bench_cancel(worker->timers[slot], &worker->ops, &worker->errors);
+				}
+			}
+			break;
+
+		case BENCH_CANCEL95:
+			// Long lived Timeouts Stopped and re-Started over and over, 95 % are cancelled before they expire
+			for(slot = 0; slot < BENCH_CANCEL95_RING; slot++) {
+				worker->timers[slot] = bench_start(&worker->recs[slot],
+					((slot % BENCH_CANCEL95_FIRE) == 0) ? BENCH_TICK_NS : BENCH_CANCEL_DLY_NS, 0, &worker->ops, &worker->errors);
+			}
+
+			for(i = 0; __atomic_load_n(&bench_stop, __ATOMIC_RELAXED) == RTOS_FALSE; i++) {
+				slot = i & (BENCH_CANCEL95_RING - 1);
+
+				if(worker->timers[slot] == NULL) {
+					continue;
+				}
+
+				// The 1 Tick ones have expired since the last Round, so the Stop finds them Completed
+				RTOSTmrStop(worker->timers[slot], RTOS_TMR_OPT_NONE, NULL, &err);
+
+				worker->recs[slot].due_ns = bench_now_ns()
+					+ (((slot % BENCH_CANCEL95_FIRE) == 0) ? BENCH_TICK_NS : BENCH_CANCEL_DLY_NS);
+
+				if(RTOSTmrStart(worker->timers[slot], &err) == RTOS_FALSE) {
+					worker->errors++;
+				}
+				worker->ops += 2;
+			}
+
+			for(slot = 0; slot < BENCH_CANCEL95_RING; slot++) {
+				if(worker->timers[slot] != NULL) {
+					bench_cancel(worker->timers[slot], &worker->ops, &worker->errors);
+				}
+			}
+			break;
+
+		case BENCH_SKEWED:
+			// Mostly short Timers with a long Tail, the long ones land in the upper Wheel Levels
+			for(i = 0; i < BENCH_SKEW_TIMERS; i++) {
+				seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+				if(((seed >> 33) % 100) < BENCH_SKEW_LONG_PCT) {
+					worker->timers[i] = bench_start(&worker->recs[i], (1 + ((seed >> 40) % 10)) * 1000000000ULL, 0,
+						&worker->ops, &worker->errors);
+				}
+				else {
+					worker->timers[i] = bench_start(&worker->recs[i], (1 + ((seed >> 40) % 10)) * 1000000ULL, 0,
+						&worker->ops, &worker->errors);
+				}
+			}
+			break;
+
+		case BENCH_PERIODIC:
+			// Only Start the Periodic Timers, they are deleted once the Run is over
+			for(i = worker->id; i < BENCH_PERIODIC_TIMERS; i += worker->thread_count) {
+				worker->timers[i] = bench_start(&worker->recs[i], 0, (1 + (i % BENCH_PERIODIC_MAX_MS)) * 1000000ULL,
+					&worker->ops, &worker->errors);
+			}
+			break;
+	}
+
+	return worker;
+}
+
+// Run one Workload with thread_count Threads and print its Result
+INT64U bench_workload(INT8U workload, const char *name, INT32U thread_count)
+{
+	INT32U i;
+	INT64U ops = 0;
+	INT64U errors = 0;
+	INT64U start;
+	INT64U elapsed;
+	INT64U tick_ns = 0;
+	INT64U tick_count = 0;
+	INT64U tick_max_ns = 0;
+	INT64U fired;
+	INT32U per_thread;
+	BENCH_WORKER *workers;
+	BENCH_REC *recs = NULL;
+	RTOS_TMR **timers = NULL;
+	INT8U err;
+
+	workers = (BENCH_WORKER*) calloc(thread_count, sizeof(BENCH_WORKER));
+
+	switch(workload) {
+		case BENCH_CANCEL:	per_thread = BENCH_CANCEL_RING;	break;
+		case BENCH_CANCEL95:	per_thread = BENCH_CANCEL95_RING;	break;
+		case BENCH_SKEWED:	per_thread = BENCH_SKEW_TIMERS;	break;
+		case BENCH_PERIODIC:	per_thread = 0;			break;
+		default:		per_thread = 1;			break;
+	}
+
+	// Periodic Timers are shared by all Threads, the others get their own Records
+	if(workload == BENCH_PERIODIC) {
+		recs = (BENCH_REC*) calloc(BENCH_PERIODIC_TIMERS, sizeof(BENCH_REC));
+		timers = (RTOS_TMR**) calloc(BENCH_PERIODIC_TIMERS, sizeof(RTOS_TMR*));
+	}
+	else {
+		recs = (BENCH_REC*) calloc((INT64U)per_thread * thread_count, sizeof(BENCH_REC));
+		timers = (RTOS_TMR**) calloc((INT64U)per_thread * thread_count, sizeof(RTOS_TMR*));
+	}
+
+	if((workers == NULL) || (recs == NULL) || (timers == NULL)) {
+		fprintf(stderr, "\n%s Benchmark could not allocate its Records\n", name);
+		free(workers);
+		free(recs);
+		free(timers);
+		return 0;
+	}
+
+	memset(bench_hist, 0, sizeof(bench_hist));
+	bench_fired = 0;
+	bench_early = 0;
+	bench_stop = RTOS_FALSE;
+
+	for(i = 0; i < RTOSTmrShardCount; i++) {
+		timer_shards[i].tick_busy_ns = 0;
+		timer_shards[i].tick_busy_count = 0;
+		timer_shards[i].tick_busy_max_ns = 0;
+	}
+
+	start = bench_now_ns();
+
+	for(i = 0; i < thread_count; i++) {
+		workers[i].id = i;
+		workers[i].thread_count = thread_count;
+		workers[i].workload = workload;
+		workers[i].recs = (workload == BENCH_PERIODIC) ? recs : &recs[(INT64U)i * per_thread];
+		workers[i].timers = (workload == BENCH_PERIODIC) ? timers : &timers[(INT64U)i * per_thread];
+		pthread_create(&workers[i].thread, NULL, &bench_worker, &workers[i]);
+	}
+
+	// Churn and Cancel run for a fixed Time, Periodic Timers fire for that Time
+	if(workload != BENCH_SKEWED) {
+		bench_sleep_ns(BENCH_RUN_NS);
+		__atomic_store_n(&bench_stop, RTOS_TRUE, __ATOMIC_RELAXED);
+	}
+
+	for(i = 0; i < thread_count; i++) {
+		pthread_join(workers[i].thread, NULL);
+		ops += workers[i].ops;
+		errors += workers[i].errors;
+	}
+
+	elapsed = bench_now_ns() - start;
+
+	// Let the short Skewed Timers expire, then cancel the long Tail
+	if(workload == BENCH_SKEWED) {
+		bench_sleep_ns(20000000ULL);
+
+		for(i = 0; i < per_thread * thread_count; i++) {
+			if(timers[i] != NULL) {
+				bench_cancel(timers[i], &ops, &errors);
+			}
+		}
+	}
+
+	if(workload == BENCH_PERIODIC) {
+		for(i = 0; i < BENCH_PERIODIC_TIMERS; i++) {
+			if(timers[i] != NULL) {
+				RTOSTmrDel(timers[i], &err);
+			}
+		}
+	}
+
+	for(i = 0; i < RTOSTmrShardCount; i++) {
+		tick_ns += timer_shards[i].tick_busy_ns;
+		tick_count += timer_shards[i].tick_busy_count;
+
+		if(timer_shards[i].tick_busy_max_ns > tick_max_ns) {
+			tick_max_ns = timer_shards[i].tick_busy_max_ns;
+		}
+	}
+
+	fired = __atomic_load_n(&bench_fired, __ATOMIC_RELAXED);
+
+	// The Periodic Workload only counts Fires
+	if(workload == BENCH_PERIODIC) {
+		ops = fired;
+	}
+
+	fprintf(stdout, "{\"bench\":\"%s\",\"queue\":\"%s\",\"threads\":%u,\"shards\":%u,\"lazy_cancel\":%u,\"ops\":%llu,\"ops_per_sec\":%.0f,\"errors\":%llu,"
+		"\"busy_ticks\":%llu,\"tick_ns_avg\":%.1f,\"tick_ns_max\":%llu,\"fired\":%llu,\"early\":%llu,"
+		"\"late_p50_ns\":%llu,\"late_p99_ns\":%llu,\"late_p999_ns\":%llu}\n",
+		name, timer_queue->name, thread_count, RTOSTmrShardCount, RTOSTmrCfg.RTOSTmrLazyCancel, ops, (double)ops * 1e9 / elapsed, errors,
+		tick_count, (tick_count == 0) ? 0.0 : (double)tick_ns / tick_count, tick_max_ns, fired, bench_early,
+		bench_hist_percentile(0.50), bench_hist_percentile(0.99), bench_hist_percentile(0.999));
+	fflush(stdout);
+
+	free(workers);
+	free(recs);
+	free(timers);
+
+	return bench_early;
+}
+
+int main(int argc, char **argv)
+{
+	INT32U i;
+	INT32U *order;
+	INT32U threads;
+	INT32U max_threads;
+	INT32U shards;
+	INT8U lazy;
+	INT8U queue;
+	INT8U backend;
+	INT32U bad;
+	INT64U early = 0;
+	RTOS_TMR **timers;
+	RTOS_TMR_CFG cfg;
+	INT8U err;
+
+	// TimerBench wrap, checks the 64 bit Tick across 2^32 Tick Boundaries with every Timer Queue and exits with 1 on a Failure
+	if((argc > 1) && (strcmp(argv[1], "wrap") == 0)) {
+		if(Create_Timer_Pool(BENCH_WRAP_TIMERS) != RTOS_SUCCESS) {
+			fprintf(stderr, "\nTimer pool could not be created due to the Memory Error\n");
+			return 1;
+		}
+
+		bad = 0;
+
+		for(backend = RTOS_TMR_QUEUE_WHEEL; backend <= RTOS_TMR_QUEUE_PAIRING; backend++) {
+			bad += bench_wrap(backend);
+		}
+		return (bad == 0) ? 0 : 1;
+	}
+
+	// TimerBench stress [threads], checks the Mailbox with Starts, Stops and Deletes of the same Timers from every Thread
+	// and the Recycling of a fixed Pool Deleted from another Thread, exits with 1 on a Timer left Running but not armed
+	// or not given back to the Pool
+	if((argc > 1) && (strcmp(argv[1], "stress") == 0)) {
+		threads = (argc > 2) ? (INT32U)atoi(argv[2]) : 4;
+		bad = 0;
+
+		for(backend = RTOS_TMR_QUEUE_WHEEL; backend <= RTOS_TMR_QUEUE_PAIRING; backend++) {
+			bad += bench_stress(backend, (threads < 1) ? 1 : threads);
+		}
+
+		// Deletes from another Thread have to reach the Pool with every Tick Source run by a Timer Task
+		for(backend = RTOS_TMR_TICK_SIGNAL; backend <= RTOS_TMR_TICK_TIMERFD; backend++) {
+			bad += bench_recycle(backend);
+		}
+		return (bad == 0) ? 0 : 1;
+	}
+
+	// TimerBench early, checks that no Timer fires before its Delay has passed with every Tick Source run by a Timer Task,
+	// exits with 1 on an early or a missing Fire
+	if((argc > 1) && (strcmp(argv[1], "early") == 0)) {
+		bad = 0;
+
+		for(backend = RTOS_TMR_TICK_SIGNAL; backend <= RTOS_TMR_TICK_TIMERFD; backend++) {
+			bad += bench_early_check(backend);
+		}
+		return (bad == 0) ? 0 : 1;
+	}
+
+	// TimerBench cost, Figures of the Static Build Table, run once from a default and once from a Static Build
+	if((argc > 1) && (strcmp(argv[1], "cost") == 0)) {
+		return (int)bench_cost();
+	}
+
+	// TimerBench [max threads] [shards] [lazy cancel] [queue], Workloads run with 1, 2, 4 .. max threads
+	max_threads = (argc > 1) ? (INT32U)atoi(argv[1]) : (INT32U)sysconf(_SC_NPROCESSORS_ONLN);
+	shards = (argc > 2) ? (INT32U)atoi(argv[2]) : 1;
+	lazy = (argc > 3) ? (INT8U)atoi(argv[3]) : RTOS_FALSE;
+	queue = (argc > 4) ? (INT8U)atoi(argv[4]) : RTOS_TMR_QUEUE_WHEEL;
+
+	if(max_threads < 1) {
+		max_threads = 1;
+	}
+
+	// Hot Records come straight from the Slab, nothing else of the Manager is started
+	if(Create_Timer_Pool(BENCH_SCAN_TIMERS) != RTOS_SUCCESS) {
+		fprintf(stderr, "\nTimer pool could not be created due to the Memory Error\n");
+		return 1;
+	}
+
+	order = (INT32U*) malloc(sizeof(INT32U) * BENCH_SCAN_TIMERS);
+
+	if(order == NULL) {
+		fprintf(stderr, "\nScan Benchmark could not allocate the List Order\n");
+		return 1;
+	}
+
+	// Timers in Allocation order
+	for(i = 0; i < BENCH_SCAN_TIMERS; i++) {
+		order[i] = i;
+	}
+
+	bench_scan_flat(order, "sequential");
+	bench_scan_hot(order, "sequential");
+
+	// Timers scattered over the Pool, as Slot Lists end up after long Churn
+	bench_shuffle(order, BENCH_SCAN_TIMERS);
+
+	bench_scan_flat(order, "random");
+	bench_scan_hot(order, "random");
+
+	free(order);
+	Destroy_Timer_Pool();
+
+	// Every Timer Queue with every Delay Distribution, on a Pool of their own
+	timers = (RTOS_TMR**) malloc(sizeof(RTOS_TMR*) * BENCH_QUEUE_TIMERS);
+
+	if((timers == NULL) || (Create_Timer_Pool(BENCH_QUEUE_TIMERS) != RTOS_SUCCESS)) {
+		fprintf(stderr, "\nQueue Benchmark could not allocate its Timers\n");
+		return 1;
+	}
+
+	for(backend = RTOS_TMR_QUEUE_WHEEL; backend <= RTOS_TMR_QUEUE_PAIRING; backend++) {
+		bench_queue(backend, 0, BENCH_DELAY_SHORT, "short", timers);
+		bench_queue(backend, 0, BENCH_DELAY_MIXED, "mixed", timers);
+		bench_queue(backend, 0, BENCH_DELAY_LONG, "long", timers);
+	}
+
+	// Hash Table grown online from its smallest Size
+	bench_queue(RTOS_TMR_QUEUE_HASH, RTOS_TMR_HASH_MIN, BENCH_DELAY_SHORT, "short", timers);
+	bench_queue(RTOS_TMR_QUEUE_HASH, RTOS_TMR_HASH_MIN, BENCH_DELAY_LONG, "long", timers);
+
+	// Hand the cached Timers back before their Pool goes
+	timer_cache_drain(&timer_cache, timer_cache.count);
+	free(timers);
+	Destroy_Timer_Pool();
+
+	// Workloads run on a Tickless Manager with a fine Tick, Callbacks stay in the Timer Tasks; the Hash Queue needs a Heartbeat
+	RTOSTmrCfgDefault(&cfg);
+	cfg.RTOSTmrTickSrc = (queue == RTOS_TMR_QUEUE_HASH) ? RTOS_TMR_TICK_TIMERFD : RTOS_TMR_TICK_TICKLESS;
+	cfg.RTOSTmrTickRate = BENCH_TICK_NS;
+	cfg.RTOSTmrShards = shards;
+	cfg.RTOSTmrPoolSize = 65536;
+	cfg.RTOSTmrLazyCancel = (lazy != 0) ? RTOS_TRUE : RTOS_FALSE;
+	cfg.RTOSTmrQueue = queue;
+
+	if(RTOSTmrConfigure(&cfg, &err) == RTOS_FALSE) {
+		fprintf(stderr, "\nTimer Manager could not be configured, error = %d\n", err);
+		return 1;
+	}
+
+	RTOSTmrInit();
+
+	for(threads = 1; ; threads = (threads * 2 > max_threads) ? max_threads : threads * 2) {
+		early += bench_workload(BENCH_CHURN, "churn", threads);
+		early += bench_workload(BENCH_CANCEL, "cancel", threads);
+		early += bench_workload(BENCH_CANCEL95, "cancel95", threads);
+		early += bench_workload(BENCH_PERIODIC, "periodic", threads);
+		early += bench_workload(BENCH_SKEWED, "skewed", threads);
+
+		if(threads >= max_threads) {
+			break;
+		}
+	}
+
+	// Lateness is never negative, a Timer must not fire before its Delay has passed
+	if(early != 0) {
+		fprintf(stderr, "\n%llu Timers fired before their Deadline\n", early);
+		return 1;
+	}
+	return 0;
+}